@@ -0,0 +1,361 @@
+// Times each step a user goes through on its own and prints the results as JSON, so the output of two versions
+// can be saved and compared to catch a step that got slower or started allocating
+//
+// Build from the repository root with:
+// g++ bench/hotPathBench.cpp database.cpp userStore.cpp shardedUserStore.cpp phoneNumber.cpp utf8.cpp validator.cpp mappedFile.cpp importPipeline.cpp snapshot.cpp journal.cpp stringPool.cpp nameScan.cpp nameIndex.cpp stats.cpp uninorms.cpp uninormsTables.cpp -I. -std=c++20 -O2 -o hotPathBench.out
+//
+// ./hotPathBench.out [--records N] [--bad-names R] [--bad-phones R] [--seed S] [--runs N]
+// records defaults to 200000. bad-names and bad-phones are the share of names and phone numbers that should be
+// rejected, 0.1 and 0.2 by default. The same seed always generates the same records. Each step is run runs times
+// (5 by default) and the median is reported
+//
+// Steps: decodeUTF8, normalizeName (decoding, NFC and the whitespace cleanup), uninorms::nfc on its own,
+// decodeUTF8 followed by uninorms::nfc_if_needed next to decodeUTF8NFC doing both in one pass,
+// validateName, validatePhoneNumber, populateFromFile and the interactive LIST
+// For every step it reports ns per op, ops per second and allocations per op. accepted is how many ops succeeded,
+// or for uninorms::nfc how many names it changed, so a change in behaviour shows up next to a change in speed
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "database.hpp"
+#include "uninorms.h"
+
+// Every allocation in the program goes through here so each step can report how many it made
+static std::atomic<size_t> Allocations{0};
+
+void* operator new(size_t size) {
+    Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) return memory;
+    throw std::bad_alloc();
+}
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, size_t) noexcept { std::free(memory); }
+
+namespace {
+
+struct Record {
+    std::string name;
+    std::string phoneNumber;
+};
+
+struct Options {
+    size_t records = 200000;
+    double badNames = 0.1;
+    double badPhones = 0.2;
+    unsigned seed = 1;
+    int runs = 5;
+};
+
+// throws away everything written to it, so printing is timed without the terminal
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Generates names in several scripts and phone numbers in the formats good.txt and bad.txt use
+class Generator {
+public:
+    explicit Generator(unsigned seed) : Random(seed) {}
+
+    Record next(const Options& options) {
+        Record record;
+        std::u32string name = validName();
+        if (chance(options.badNames)) breakName(name);
+        encodeUTF8(name, record.name);
+        record.phoneNumber = chance(options.badPhones) ? badPhoneNumber() : validPhoneNumber();
+        return record;
+    }
+
+private:
+    std::mt19937 Random;
+
+    bool chance(double probability) { return std::uniform_real_distribution<>(0, 1)(Random) < probability; }
+    uint32_t pick(uint32_t count) { return Random() % count; }
+    char32_t between(char32_t first, char32_t last) { return first + pick(last - first + 1); }
+
+    std::u32string word(char32_t first, char32_t last, size_t minLength, size_t maxLength) {
+        std::u32string word;
+        size_t length = minLength + pick(maxLength - minLength + 1);
+        for (size_t i = 0; i < length; i++) word += between(first, last);
+        return word;
+    }
+
+    std::u32string validName() {
+        switch (pick(8)) {
+        case 0: { // plain ASCII, the most common case
+            std::u32string name = word(U'a', U'z', 3, 9);
+            name[0] -= 32;
+            std::u32string last = word(U'a', U'z', 3, 12);
+            last[0] -= 32;
+            return name + U' ' + last;
+        }
+        case 1: { // accented letters written as a letter and a combining mark, so NFC has to combine them
+            std::u32string name;
+            for (size_t i = 0, length = 4 + pick(8); i < length; i++) {
+                name += between(U'a', U'z');
+                if (pick(3) == 0) name += between(0x300, 0x308);
+            }
+            return name;
+        }
+        case 2: // Cyrillic
+            return word(0x410, 0x44F, 3, 10) + U' ' + word(0x410, 0x44F, 4, 12);
+        case 3: // CJK
+            return word(0x4E00, 0x9FFF, 2, 4);
+        case 4: // Arabic
+            return word(0x628, 0x64A, 3, 8) + U' ' + word(0x628, 0x64A, 3, 8);
+        case 5: // Hangul syllables, which NFC leaves alone
+            return word(0xAC00, 0xD7A3, 2, 3) + U' ' + word(0xAC00, 0xD7A3, 1, 2);
+        case 6: { // Vietnamese letters that are already composed, sometimes followed by a mark that has to be sorted into them
+            std::u32string name = word(0x1EA0, 0x1EF9, 2, 6);
+            if (pick(4) == 0) name += char32_t(0x323);
+            return name + U' ' + word(U'a', U'z', 3, 8);
+        }
+        default: { // Devanagari consonants with vowel signs
+            std::u32string name;
+            for (size_t i = 0, length = 2 + pick(5); i < length; i++) {
+                name += between(0x915, 0x939);
+                if (pick(2)) name += between(0x93E, 0x94C);
+            }
+            return name;
+        }
+        }
+    }
+
+    // a control character or an invisible one somewhere in the name, or nothing but spaces
+    void breakName(std::u32string& name) {
+        switch (pick(3)) {
+        case 0: name.insert(name.begin() + pick(name.size()), char32_t(between(1, 31))); break;
+        case 1: name.insert(name.begin() + pick(name.size()), char32_t(0x2060)); break;
+        default: name = U"   "; break;
+        }
+    }
+
+    std::string validPhoneNumber() {
+        static constexpr int AreaCodes[] = {202, 212, 213, 305, 312, 415, 617, 718, 972, 214};
+        int area = AreaCodes[pick(std::size(AreaCodes))];
+        int exchange = 200 + pick(800);
+        int line = pick(10000);
+        char text[64];
+        switch (pick(6)) {
+        case 0: std::snprintf(text, sizeof(text), "(%d) %03d-%04d", area, exchange, line); break;
+        case 1: std::snprintf(text, sizeof(text), "%d-%03d-%04d", area, exchange, line); break;
+        case 2: std::snprintf(text, sizeof(text), "+1 %d-%03d-%04d", area, exchange, line); break;
+        case 3: std::snprintf(text, sizeof(text), "%d-%03d-%04d x%d", area, exchange, line, int(pick(1000))); break;
+        case 4: std::snprintf(text, sizeof(text), "(%d)-%03d-%04d", area, exchange, line); break;
+        default: std::snprintf(text, sizeof(text), "+975 (%d)-%03d-%04d", area, exchange, line); break;
+        }
+        return text;
+    }
+
+    std::string badPhoneNumber() {
+        int exchange = 200 + pick(800);
+        int line = pick(10000);
+        char text[64];
+        switch (pick(6)) {
+        case 0: std::snprintf(text, sizeof(text), "972%03d%04d", exchange, line); break;
+        case 1: std::snprintf(text, sizeof(text), "(972)(%03d)(%04d)", exchange, line); break;
+        case 2: std::snprintf(text, sizeof(text), "972-%03d-%04d extendo 100", exchange, line); break;
+        case 3: std::snprintf(text, sizeof(text), "+99 972-%03d-%04d", exchange, line); break;
+        case 4: std::snprintf(text, sizeof(text), "299-%03d-%04d", exchange, line); break;
+        default: std::snprintf(text, sizeof(text), "This is a phone number"); break;
+        }
+        return text;
+    }
+};
+
+struct Result {
+    const char* name;
+    size_t ops;
+    size_t accepted;
+    double nsPerOp;
+    double allocationsPerOp;
+};
+
+// runs step the requested number of times and keeps the median. step returns how many of its ops succeeded
+template<typename Step>
+Result measure(const char* name, size_t ops, const Options& options, Step&& step) {
+    std::vector<double> times;
+    size_t accepted = 0;
+    size_t allocations = 0;
+    for (int run = 0; run < options.runs; run++) {
+        size_t before = Allocations.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        accepted = step();
+        auto stop = std::chrono::steady_clock::now();
+        allocations += Allocations.load(std::memory_order_relaxed) - before;
+        times.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+    }
+    std::sort(times.begin(), times.end());
+    double total = ops * double(options.runs);
+    return {name, ops, accepted, times[times.size() / 2] / ops, allocations / total};
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        if (!std::strcmp(argv[i], "--records")) options.records = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--bad-names")) options.badNames = std::strtod(argv[i + 1], nullptr);
+        else if (!std::strcmp(argv[i], "--bad-phones")) options.badPhones = std::strtod(argv[i + 1], nullptr);
+        else if (!std::strcmp(argv[i], "--seed")) options.seed = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (!std::strcmp(argv[i], "--runs")) options.runs = std::max(1, std::atoi(argv[i + 1]));
+        else return false;
+    }
+    return argc % 2 == 1 && options.records > 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "usage: %s [--records N] [--bad-names R] [--bad-phones R] [--seed S] [--runs N]\n", argv[0]);
+        return 1;
+    }
+
+    Generator generator(options.seed);
+    std::vector<Record> records;
+    records.reserve(options.records);
+    for (size_t i = 0; i < options.records; i++) records.push_back(generator.next(options));
+
+    // the inputs for the steps that start part way through
+    std::vector<std::u32string> decoded(records.size());
+    std::vector<std::u32string> normalized(records.size());
+    std::unordered_set<std::string> users;
+    size_t nfcMismatches = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        decodeUTF8(records[i].name, decoded[i]);
+        // the one pass normalizer has to give exactly what the passes it replaces do
+        std::u32string passes = decoded[i], fused;
+        ufal::unilib::uninorms::nfc_if_needed(passes);
+        decodeUTF8NFC(records[i].name, fused);
+        nfcMismatches += passes != fused;
+        PhoneNumber phoneNumber;
+        if (Validator::normalizeName(records[i].name, normalized[i]) && Validator::validateName(normalized[i]) == RejectReason::None
+            && Validator::validatePhoneNumber(records[i].phoneNumber, phoneNumber) == RejectReason::None) {
+            std::string key;
+            encodeUTF8(normalized[i], key);
+            users.insert(key + '\t' + phoneNumber.toString());
+        }
+    }
+
+    const std::string path = "hotPathBench.tmp";
+    {
+        std::ofstream out(path);
+        for (const auto& record : records) out << record.name << '\n' << record.phoneNumber << '\n';
+    }
+
+    NullBuffer null;
+    auto* console = std::cout.rdbuf(&null);
+
+    std::vector<Result> results;
+    std::u32string utf32;
+
+    results.push_back(measure("decodeUTF8", records.size(), options, [&] {
+        size_t accepted = 0;
+        for (const auto& record : records) accepted += decodeUTF8(record.name, utf32);
+        return accepted;
+    }));
+
+    results.push_back(measure("normalizeName", records.size(), options, [&] {
+        size_t accepted = 0;
+        for (const auto& record : records) accepted += Validator::normalizeName(record.name, utf32);
+        return accepted;
+    }));
+
+    // copied into a reused buffer first since nfc works in place. The copy does not allocate once the buffer is big enough
+    results.push_back(measure("uninorms::nfc", records.size(), options, [&] {
+        size_t changed = 0;
+        for (const auto& name : decoded) {
+            utf32.assign(name);
+            ufal::unilib::uninorms::nfc(utf32);
+            changed += utf32 != name;
+        }
+        return changed;
+    }));
+
+    // the same work from UTF-8 to NFC done the old way, decoding the name and then normalizing it in its own passes,
+    // and in one pass that normalizes each combining sequence as it is decoded
+    results.push_back(measure("decodeUTF8+nfc_if_needed", records.size(), options, [&] {
+        size_t accepted = 0;
+        for (const auto& record : records) {
+            if (!decodeUTF8(record.name, utf32)) continue;
+            ufal::unilib::uninorms::nfc_if_needed(utf32);
+            accepted++;
+        }
+        return accepted;
+    }));
+
+    results.push_back(measure("decodeUTF8NFC", records.size(), options, [&] {
+        size_t accepted = 0;
+        for (const auto& record : records) accepted += decodeUTF8NFC(record.name, utf32);
+        return accepted;
+    }));
+
+    results.push_back(measure("validateName", records.size(), options, [&] {
+        size_t accepted = 0;
+        for (const auto& name : normalized) accepted += Validator::validateName(name) == RejectReason::None;
+        return accepted;
+    }));
+
+    results.push_back(measure("validatePhoneNumber", records.size(), options, [&] {
+        size_t accepted = 0;
+        PhoneNumber phoneNumber;
+        for (const auto& record : records) accepted += Validator::validatePhoneNumber(record.phoneNumber, phoneNumber) == RejectReason::None;
+        return accepted;
+    }));
+
+    results.push_back(measure("populateFromFile", records.size(), options, [&] {
+        Database database;
+        std::ifstream file(path);
+        database.populateFromFile(file);
+        return users.size();
+    }));
+
+    // LIST goes through the command prompt like it would for a person, with std::cin reading from a string
+    {
+        Database database;
+        std::ifstream file(path);
+        database.populateFromFile(file);
+        auto* keyboard = std::cin.rdbuf();
+        results.push_back(measure("list", users.size(), options, [&] {
+            std::istringstream command("LIST\n");
+            std::cin.rdbuf(command.rdbuf());
+            database.getCommand();
+            return users.size();
+        }));
+        std::cin.rdbuf(keyboard);
+    }
+
+    std::cout.rdbuf(console);
+    std::remove(path.c_str());
+
+    std::printf("{\n");
+    std::printf("  \"compiler\": \"%s\",\n", __VERSION__);
+    std::printf("  \"records\": %zu,\n", options.records);
+    std::printf("  \"badNames\": %g,\n", options.badNames);
+    std::printf("  \"badPhones\": %g,\n", options.badPhones);
+    std::printf("  \"seed\": %u,\n", options.seed);
+    std::printf("  \"runs\": %d,\n", options.runs);
+    std::printf("  \"nfcMismatches\": %zu,\n", nfcMismatches);
+    std::printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& result = results[i];
+        std::printf("    {\"name\": \"%s\", \"ops\": %zu, \"accepted\": %zu, \"nsPerOp\": %.2f, \"recordsPerSecond\": %.0f, \"allocationsPerOp\": %.3f}%s\n",
+            result.name, result.ops, result.accepted, result.nsPerOp, 1e9 / result.nsPerOp, result.allocationsPerOp, i + 1 < results.size() ? "," : "");
+    }
+    std::printf("  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Times Database::populateFromFile and Database::loadFile on generated files of increasing size
+// The sizes go up by 10 times from 10 thousand records. With the hashed user store the time per record should stay
+// flat as the file grows, which the last column shows as the time per record compared to the smallest file
+//
+// Build from the repository root with:
+// g++ bench/importBench.cpp database.cpp userStore.cpp shardedUserStore.cpp phoneNumber.cpp utf8.cpp validator.cpp mappedFile.cpp importPipeline.cpp snapshot.cpp journal.cpp stringPool.cpp nameScan.cpp nameIndex.cpp stats.cpp uninorms.cpp uninormsTables.cpp -I. -std=c++20 -O2 -o importBench.out
+//
+// ./importBench.out [maxRecords] [threads]   (defaults to 10000000 records, so 10k, 100k, 1M and 10M)
+// threads is passed to loadFile and defaults to 1
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "database.hpp"
+
+// writes count unique name/phone pairs. Every name is distinct so nothing is rejected as a duplicate
+static void generate(const std::string& path, size_t count) {
+    std::ofstream out(path);
+    char phone[32];
+    for (size_t i = 0; i < count; i++) {
+        std::snprintf(phone, sizeof(phone), "(202) %03zu-%04zu", 200 + (i / 10000) % 800, i % 10000);
+        out << "User " << i << '\n' << phone << '\n';
+    }
+}
+
+int main(int argc, char* argv[]) {
+    size_t maxRecords = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    unsigned threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1;
+    const std::string path = "importBench.tmp";
+
+    std::printf("%8s %12s %12s %14s %12s %10s\n", "loader", "records", "seconds", "records/s", "ns/record", "vs 10k");
+
+    // the time per record of the smallest file for each loader
+    double first[2] = {0, 0};
+
+    for (size_t count = 10000; count <= maxRecords; count *= 10) {
+        generate(path, count);
+
+        // populateFromFile reads with std::getline, loadFile memory maps the file
+        for (int mapped = 0; mapped < 2; mapped++) {
+            Database db;
+            std::ifstream file(path);
+
+            // silence the progress output while timing
+            std::ostringstream sink;
+            auto old = std::cout.rdbuf(sink.rdbuf());
+            auto start = std::chrono::steady_clock::now();
+            if (mapped) db.loadFile(path.c_str(), threads);
+            else db.populateFromFile(file);
+            auto stop = std::chrono::steady_clock::now();
+            std::cout.rdbuf(old);
+
+            double seconds = std::chrono::duration<double>(stop - start).count();
+            double perRecord = seconds * 1e9 / count;
+            if (first[mapped] == 0) first[mapped] = perRecord;
+            std::printf("%8s %12zu %12.3f %14.0f %12.1f %9.2fx\n", mapped ? "mmap" : "getline", count, seconds, count / seconds, perRecord, perRecord / first[mapped]);
+        }
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Measures how much memory the UserStore uses per user
+// The names are drawn from a fixed set of about 51 thousand so they repeat the way real names do, and every phone number is unique
+//
+// Build from the repository root with:
+// g++ bench/memoryBench.cpp userStore.cpp stringPool.cpp nameIndex.cpp phoneNumber.cpp -I. -std=c++20 -O2 -o memoryBench.out
+//
+// ./memoryBench.out [users]   (defaults to 1000000)
+
+#include <malloc.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "userStore.hpp"
+
+// the big vectors come straight from mmap, which uordblks does not count
+static size_t allocated() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    const char* first[] = {"James", "Mary", "Robert", "Patricia", "John", "Jennifer", "Michael", "Linda",
+                           "José", "Zoë", "Søren", "Mohammed", "Wei", "Yuki", "Olga", "Ana"};
+    const char* last[] = {"Smith", "Johnson", "Williams", "Brown", "Jones", "García", "Miller", "Davis",
+                          "Rodríguez", "Martínez", "Müller", "Nakamura", "Ivanova", "O'Brien", "Nguyen", "Kim"};
+
+    const int areaCodes[] = {202, 212, 213, 305, 312, 415, 617, 718};
+
+    // generated up front so only the store is counted
+    std::vector<std::pair<std::string, PhoneNumber>> users;
+    users.reserve(count);
+    char name[64];
+    char phone[32];
+    for (size_t i = 0; i < count; i++) {
+        std::snprintf(name, sizeof(name), "%s %s %zu", first[i % 16], last[(i / 16) % 16], (i / 256) % 200);
+        std::snprintf(phone, sizeof(phone), "%d %03zu %04zu", areaCodes[(i / 8000000) % 8], 200 + (i / 10000) % 800, i % 10000);
+        PhoneNumber phoneNumber;
+        parsePhoneNumber(phone, phoneNumber);
+        users.emplace_back(name, phoneNumber);
+    }
+
+    size_t before = allocated();
+    UserStore store;
+    for (const auto& [name, phoneNumber] : users) store.insert(name, phoneNumber);
+    size_t after = allocated();
+
+    std::printf("%zu users\n", store.size());
+    std::printf("%.1f bytes/user allocated\n", double(after - before) / store.size());
+    std::printf("%.1f bytes/user by memoryUsage()\n", double(store.memoryUsage()) / store.size());
+    return 0;
+}
@@ -0,0 +1,102 @@
+// Compares the versions of findBannedCharacter that Validator::validateName uses on names in different scripts
+// The scalar version is the loop validateName used to have
+//
+// Build from the repository root with:
+// g++ bench/nameBench.cpp nameScan.cpp -I. -std=c++20 -O2 -o nameBench.out
+//
+// ./nameBench.out [names]   (defaults to 10000 different names per set, each checked 200 times)
+// validateName always checks the name that was just normalized, so the names are kept small enough to stay in cache
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nameScan.hpp"
+
+namespace {
+
+constexpr int Repeats = 200;
+
+// names of random code points between first and last with the odd space
+std::vector<std::u32string> generate(size_t count, size_t minLength, size_t maxLength, char32_t first, char32_t last, double spaces) {
+    std::mt19937 rng(42);
+    std::vector<std::u32string> names(count);
+    for (auto& name : names) {
+        size_t length = minLength + rng() % (maxLength - minLength + 1);
+        for (size_t i = 0; i < length; i++) {
+            bool space = i > 0 && i + 1 < length && name.back() != U' ' && std::uniform_real_distribution<>(0, 1)(rng) < spaces;
+            name += space ? U' ' : char32_t(first + rng() % (last - first + 1));
+        }
+    }
+    return names;
+}
+
+// emoji mixed in with Latin letters, as in "Ana 🌸 Lee"
+std::vector<std::u32string> generateEmoji(size_t count) {
+    std::mt19937 rng(7);
+    std::vector<std::u32string> names(count);
+    for (auto& name : names) {
+        size_t length = 6 + rng() % 20;
+        for (size_t i = 0; i < length; i++) {
+            name += rng() % 3 ? char32_t(0x1F300 + rng() % 0x300) : char32_t(U'a' + rng() % 26);
+        }
+    }
+    return names;
+}
+
+void time(const char* set, const char* version, size_t (*scan)(std::u32string_view), const std::vector<std::u32string>& names) {
+    // packed back to back like the validator's buffers so the benchmark is not just measuring cache misses
+    std::u32string packed;
+    std::vector<std::u32string_view> views;
+    for (const auto& name : names) packed += name;
+    size_t offset = 0;
+    for (const auto& name : names) {
+        views.push_back(std::u32string_view(packed).substr(offset, name.size()));
+        offset += name.size();
+    }
+
+    // the best of a few runs so a single slow run does not skew the numbers
+    double best = 1e30;
+    size_t found = 0;
+    for (int run = 0; run < 5; run++) {
+        auto start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < Repeats; repeat++) {
+            for (auto name : views) found += scan(name) != std::u32string_view::npos;
+        }
+        auto stop = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(stop - start).count() / Repeats);
+    }
+
+    std::printf("%-8s %-8s %10.2f %14.1f %10zu\n", set, version, best * 1e9 / names.size(), packed.size() / best / 1e6, found / (5 * Repeats));
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000;
+
+    struct Set {
+        const char* name;
+        std::vector<std::u32string> names;
+    };
+    Set sets[] = {
+        {"ascii", generate(count, 5, 30, U'a', U'z', 0.15)},
+        {"cjk", generate(count, 2, 6, 0x4E00, 0x9FFF, 0)},
+        {"emoji", generateEmoji(count)},
+    };
+
+    std::printf("findBannedCharacter uses %s on this machine\n\n", bannedCharacterScanner());
+    std::printf("%-8s %-8s %10s %14s %10s\n", "names", "version", "ns/name", "Mcodepoints/s", "rejected");
+    for (const auto& set : sets) {
+        time(set.name, "scalar", findBannedCharacterScalar, set.names);
+#if defined(__x86_64__)
+        time(set.name, "sse2", findBannedCharacterSSE2, set.names);
+        if (cpuHasAVX2()) time(set.name, "avx2", findBannedCharacterAVX2, set.names);
+#endif
+        time(set.name, "dispatch", findBannedCharacter, set.names);
+    }
+    return 0;
+}
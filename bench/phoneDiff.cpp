@@ -0,0 +1,289 @@
+// Checks parsePhoneNumber against the std::regex validation it replaced, which is copied below as it was
+// Every phone number in good.txt and bad.txt is tried, then a corpus of generated numbers: North American and
+// international numbers in every punctuation style, with and without extentions, plus random edits to them so most
+// of the corpus sits right on the edge between valid and invalid. Both have to agree on whether each one is valid,
+// and for a valid one on its canonical text. The old code threw std::out_of_range for "+001" numbers with too few
+// digits, which counts as rejecting them, since that is what the new parser does
+//
+// Build from the repository root with:
+// g++ bench/phoneDiff.cpp phoneNumber.cpp -I. -std=c++20 -O2 -o phoneDiff.out
+//
+// ./phoneDiff.out [cases] [seed]   (defaults to 300000 generated cases and seed 1)
+// Prints every mismatch, up to 20, and exits with 1 if there were any
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "phoneNumber.hpp"
+
+namespace baseline {
+
+bool validatePhoneNumber(std::string& phoneNumber) {
+    std::string extention;
+    std::string temp;
+    int matches = 0;
+
+    // If there anything other than letters, numbers, or a handfull of punctuation and spaces return false
+    // This is a sanity check to throw out things that are obviously not numbers
+    if(std::regex_search(phoneNumber, std::regex("[^A-Za-z0-9\\+\\(\\)\\-., ]"))) return false;
+
+    // If there is letters it could have an extention
+    // If there is, then parse it sepratly
+    if(std::regex_search(phoneNumber, std::regex("[A-Za-z,]"))) {
+        // Make all letters lowercase for ease of parsing
+        std::transform(phoneNumber.begin(), phoneNumber.end(), phoneNumber.begin(), ::tolower);
+
+        // If there is no "x" there will be no extention
+        // Every way I could find to show an extention had an "x" and only one
+        // If there are no x's or more than one return false
+        std::smatch xMatches;
+        temp = phoneNumber;
+        while(std::regex_search(temp, xMatches, std::regex("x"))) {
+            matches++;
+            if(matches > 1) return false;
+            temp = xMatches.suffix();
+        }
+        if(matches == 0) return false;
+
+        // Search first for extentions that say "extention" and replace it with "ext."
+        // The "." at the end of "ext" makes sure that "extention." will fail later because of the extra "."
+        phoneNumber = std::regex_replace(phoneNumber, std::regex("extention"), "ext.", std::regex_constants::format_first_only);
+        // Search for extentions specified by "ext" or "ext." and replace with "x"
+        phoneNumber = std::regex_replace(phoneNumber, std::regex("ext\\.?"), "x", std::regex_constants::format_first_only);
+
+        // If there are any reamining letters other than one x, return false
+        if(std::regex_search(phoneNumber, std::regex("[a-wyz]+"))) return false;
+
+        // Match from the x to the end of the string
+        // This is the extention
+        std::smatch ext;
+        std::regex_search(phoneNumber, ext, std::regex("x.*"));
+        extention = ext[0];
+        phoneNumber = phoneNumber.substr(0, phoneNumber.size() - extention.size());
+
+        // An extention must now fit the format of "x" followed one or 0 spaces and between 1 and 15 digits
+        // I could not find an offical limit of the length of an extention and even found some sources saying
+        // they used some really long ones for niche uses like masking the number
+        // I have chosen to only allow a max of 15 digits because it is long enough to use it as a mask for a max length phone number
+        if(!std::regex_match(extention, std::regex("x\\s?[0-9]{1,15}"))) return false;
+
+        extention = std::regex_replace(extention, std::regex("\\s"), "");
+    }
+
+    // Remove trailing spaces
+    // The empty checks here and below were added. The old code called back() on an empty string for inputs like "x1"
+    if(!phoneNumber.empty() && phoneNumber.back() == ' ') phoneNumber.pop_back();
+
+    // Sometimes the country code is separated from the number by a "."
+    // If there is more than one "." in the string, return false
+    std::smatch dotMatches;
+    temp = phoneNumber;
+    matches = 0;
+    while(std::regex_search(temp, dotMatches, std::regex("\\."))) {
+        matches++;
+        if(matches > 1) return false;
+        temp = dotMatches.suffix();
+    }
+
+    // If there is "(" or ")" but not in the pattern of "([0-9]{3})" or if there is more than one instance return false
+    std::smatch parenMatches;
+    temp = phoneNumber;
+    matches = 0;
+    while(std::regex_search(temp, parenMatches, std::regex("\\(|\\)"))) {
+        matches++;
+        temp = parenMatches.suffix();
+    }
+    if(matches && !std::regex_search(phoneNumber, std::regex("\\([0-9]{3}\\)"))) return false;
+    if(matches > 2) return false;
+    
+    // replace everything except + and 0-9 with spaces
+    phoneNumber = std::regex_replace(phoneNumber, std::regex("[^0-9\\+]+"), " ");
+
+    // If there is a gap with two spaces, reduce it to one
+    // This accounts for cases like (972)-964-4333
+    phoneNumber = std::regex_replace(phoneNumber, std::regex("\\s\\s"), " ");
+
+    // Remove possible leading spaces and trailing spaces
+    if(phoneNumber[0] == ' ') phoneNumber = phoneNumber.substr(1);
+    if(!phoneNumber.empty() && phoneNumber.back() == ' ') phoneNumber.pop_back();
+
+    // If it starts with a "+" parse it as an international number
+    if(phoneNumber[0] == '+' && phoneNumber.substr(0, 3) != "+1 ") {
+        // Remove all spaces
+        phoneNumber = std::regex_replace(phoneNumber, std::regex("\\s"), "");
+
+        // I decided to not create parsers based on spesfic country codes
+        // The max length of an international number is 15 digits and the shortest is 7
+        if(!std::regex_match(phoneNumber, std::regex("\\+[0-9]{7,15}"))) return false;
+
+        // If it doesnt start with a vaild country code, return false
+        static const std::regex countryCodeRegex("^\\+(001|297|93|244|1264|358|355|376|971|54|374|1684|1268|61|43|994|257|32|229|226|880|359|973|1242|387|590|375|501|1441|591|55|1246|673|975|267|236|1|61|41|56|86|225|237|243|242|682|57|269|238|506|53|5999|61|1345|357|420|49|253|1767|45|1809|1829|1849|213|593|20|291|212|34|372|251|358|679|500|33|298|691|241|44|995|44|233|350|224|590|220|245|240|30|1473|299|502|594|1671|592|852|504|385|509|36|62|44|91|246|353|98|964|354|972|39|1876|44|962|81|76|77|254|996|855|686|1869|82|383|965|856|961|231|218|1758|423|94|266|370|352|371|853|590|212|377|373|261|960|52|692|389|223|356|95|382|976|1670|258|222|1664|596|230|265|60|262|264|687|227|672|234|505|683|31|47|977|674|64|968|92|507|64|51|63|680|675|48|1787|1939|850|351|595|970|689|974|262|40|7|250|966|249|221|65|500|4779|677|232|503|378|252|508|381|211|239|597|421|386|46|268|1721|248|963|1649|235|228|66|992|690|993|670|676|1868|216|90|688|886|255|256|380|598|1|998|3906698|379|1784|58|1284|1340|84|678|681|685|967|27|260|263)");
+        if(!std::regex_search(phoneNumber, countryCodeRegex)) return false;
+
+        // If it doesnt have a North American country code return true
+        // Otherwise remove it and continue
+        if(!std::regex_search(phoneNumber, std::regex("^\\+001"))) {
+            phoneNumber += extention;
+            return true;
+        }
+        phoneNumber = phoneNumber.substr(4);
+
+        // Reintoduce the spaces after the area code and before the phone number
+        phoneNumber.insert(6, " ");
+        phoneNumber.insert(3, " ");
+    }
+
+    if (phoneNumber.substr(0, 3) == "+1 ") {
+        phoneNumber = phoneNumber.substr(3);
+    }
+
+    // Parse as an North American number
+    // A genral check for a valid number
+    if(!std::regex_match(phoneNumber, std::regex("[2-9][0-9]{2} [0-9]{3} [0-9]{4} ?"))) return false;
+
+    // List of in-use us area codes from:
+    // https://en.wikipedia.org/wiki/List_of_North_American_Numbering_Plan_area_codes
+    static const std::regex areaCodeRegex("^(201|202|203|204|205|206|207|208|209|210|211|212|213|214|215|216|217|218|219|220|223|224|225|226|227|228|229|231|234|236|239|240|242|246|248|249|250|251|252|253|254|256|260|262|263|264|267|268|269|270|272|274|276|278|279|281|283|284|289|301|302|303|304|305|306|307|308|309|310|311|312|313|314|315|316|317|318|319|320|321|323|325|326|327|330|331|332|334|336|337|339|340|341|343|345|346|347|351|352|354|360|361|363|364|365|367|368|369|380|382|385|386|387|401|402|403|404|405|406|407|408|409|410|411|412|413|414|415|416|417|418|419|423|424|425|428|430|431|432|434|435|437|438|440|441|442|443|445|447|448|450|456|458|463|464|468|469|470|472|473|474|475|478|479|480|484|500|501|502|503|504|505|506|507|508|509|510|511|512|513|514|515|516|517|518|519|520|521|522|523|524|525|526|530|531|532|533|534|535|538|539|540|541|544|545|546|547|548|549|550|551|555|556|557|558|559|561|562|563|564|566|567|569|570|571|572|573|574|575|577|578|579|580|581|582|584|585|586|587|588|589|600|601|602|603|604|605|606|607|608|609|610|611|612|613|614|615|616|617|618|619|620|622|623|626|627|628|629|630|631|633|636|639|640|641|644|646|647|649|650|651|655|656|657|658|659|660|661|662|664|667|669|670|671|672|677|678|679|680|681|682|683|684|688|689|700|701|702|703|704|705|706|707|708|709|710|711|712|713|714|715|716|717|718|719|720|721|724|725|726|727|730|731|732|734|737|740|742|743|747|753|754|757|758|760|762|763|764|765|767|769|770|771|772|773|774|775|778|779|780|781|782|784|785|786|787|800|801|802|803|804|805|806|807|808|809|810|811|812|813|814|815|816|817|818|819|820|822|825|826|828|829|830|831|832|833|835|838|839|840|843|844|845|847|848|849|850|854|855|856|857|858|859|860|861|862|863|864|865|866|867|868|869|870|872|873|876|877|878|879|888|889|900|901|902|903|904|905|906|907|908|909|910|911|912|913|914|915|916|917|918|919|920|925|927|928|929|930|931|932|934|935|936|937|938|939|940|941|943|945|947|948|949|950|951|952|954|956|959|970|971|972|973|975|978|979|980|983|984|985|986|988|989)");
+    if(!std::regex_search(phoneNumber, areaCodeRegex)) return false;
+    
+    phoneNumber += extention;
+
+    return true;
+}
+
+} // namespace baseline
+
+namespace {
+
+// the old result: empty if the number was rejected, otherwise its canonical text
+std::string oldResult(const std::string& input) {
+    std::string phoneNumber = input;
+    try {
+        if (!phoneNumber.empty() && baseline::validatePhoneNumber(phoneNumber)) return phoneNumber;
+    } catch (const std::out_of_range&) {
+    }
+    return {};
+}
+
+std::string newResult(const std::string& input) {
+    PhoneNumber phoneNumber;
+    if (parsePhoneNumber(input, phoneNumber) != RejectReason::None) return {};
+    return phoneNumber.toString();
+}
+
+class Generator {
+public:
+    explicit Generator(unsigned seed) : Random(seed) {}
+
+    std::string next() {
+        std::string number = pick(4) == 0 ? international() : northAmerican();
+        if (pick(3) == 0) number += extention();
+        // about half of them get a few random edits
+        for (size_t edits = pick(2) ? pick(4) : 0; edits > 0; edits--) edit(number);
+        return number;
+    }
+
+private:
+    std::mt19937 Random;
+
+    size_t pick(size_t count) { return std::uniform_int_distribution<size_t>(0, count - 1)(Random); }
+    std::string digits(size_t count) {
+        std::string out;
+        for (size_t i = 0; i < count; i++) out += char('0' + pick(10));
+        return out;
+    }
+
+    std::string northAmerican() {
+        // mostly real area codes so plenty of them are valid, then any three digits
+        static const char* areaCodes[] = {"202", "214", "972", "555", "800", "212", "299", "911", "100"};
+        std::string area = pick(3) ? areaCodes[pick(std::size(areaCodes))] : digits(3);
+        std::string exchange = digits(3);
+        std::string line = digits(4);
+
+        static const char* prefixes[] = {"", "", "", "+1 ", "+1", "+1.", "+001 ", "+001", "1 ", " "};
+        std::string prefix = prefixes[pick(std::size(prefixes))];
+        switch (pick(8)) {
+            case 0: return prefix + area + "-" + exchange + "-" + line;
+            case 1: return prefix + "(" + area + ") " + exchange + "-" + line;
+            case 2: return prefix + "(" + area + ")-" + exchange + "-" + line;
+            case 3: return prefix + area + "." + exchange + "." + line;
+            case 4: return prefix + area + " " + exchange + " " + line;
+            case 5: return prefix + area + exchange + line;
+            case 6: return prefix + area + "-" + exchange + line;
+            default: return prefix + area + "." + exchange + "-" + line + " ";
+        }
+    }
+
+    std::string international() {
+        static const char* countryCodes[] = {"44", "49", "975", "33", "86", "91", "7", "1264", "3906698", "99", "0", "001"};
+        std::string number = "+" + std::string(countryCodes[pick(std::size(countryCodes))]);
+        // 3 to 16 more digits in groups, so the total is on both sides of the 7 to 15 digit limits
+        size_t rest = 3 + pick(14);
+        while (rest > 0) {
+            size_t group = std::min(rest, 1 + pick(4));
+            static const char* separators[] = {" ", "-", "", ".", " "};
+            number += separators[pick(std::size(separators))] + digits(group);
+            rest -= group;
+        }
+        return number;
+    }
+
+    std::string extention() {
+        static const char* words[] = {"x", "X", " x", " x ", "ext", "ext.", " ext. ", "extention", " Extention ", "ex", "xx", ","};
+        return words[pick(std::size(words))] + digits(pick(18));
+    }
+
+    // inserts, removes or replaces one character with one that phone numbers are made of
+    void edit(std::string& number) {
+        static const char alphabet[] = "0123456789+()-., xXetnio#";
+        char c = alphabet[pick(sizeof(alphabet) - 1)];
+        size_t at = pick(number.size() + 1);
+        switch (pick(3)) {
+            case 0: number.insert(number.begin() + at, c); break;
+            case 1: if (at < number.size()) number.erase(at, 1); break;
+            default: if (at < number.size()) number[at] = c; break;
+        }
+    }
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    size_t cases = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 300000;
+    unsigned seed = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1;
+
+    size_t checked = 0;
+    size_t accepted = 0;
+    size_t mismatches = 0;
+    auto check = [&](const std::string& input) {
+        std::string expected = oldResult(input);
+        std::string actual = newResult(input);
+        checked++;
+        accepted += !expected.empty();
+        if (expected == actual) return;
+        if (++mismatches <= 20) {
+            std::printf("mismatch on \"%s\": old %s, new %s\n", input.c_str(), expected.empty() ? "rejects" : ("\"" + expected + "\"").c_str(),
+                        actual.empty() ? "rejects" : ("\"" + actual + "\"").c_str());
+        }
+    };
+
+    // every line of the sample files, names included, since a name should not be a valid number either
+    for (const char* path : {"good.txt", "bad.txt"}) {
+        std::ifstream file(path);
+        if (!file) std::printf("could not open %s, run this from the repository root\n", path);
+        for (std::string line; std::getline(file, line);) check(line);
+    }
+
+    Generator generator(seed);
+    for (size_t i = 0; i < cases; i++) check(generator.next());
+
+    std::printf("%zu numbers checked, %zu valid, %zu mismatches\n", checked, accepted, mismatches);
+    return mismatches ? 1 : 0;
+}
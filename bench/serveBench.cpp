@@ -0,0 +1,192 @@
+// Load test for --serve. Many clients each keep several commands in flight on their own connection
+// and the answers are counted until the time is up
+//
+// Build from the repository root with:
+// g++ bench/serveBench.cpp -std=c++20 -O2 -pthread -o serveBench.out
+//
+// Start a server, then run the bench against it:
+// ./main.out --serve /tmp/users.sock
+// ./serveBench.out /tmp/users.sock [clients] [seconds] [depth] [threads] [prefill]
+//
+// Defaults to 200 clients for 5 seconds with 8 commands in flight each, spread over 4 threads.
+// Before timing, prefill users named "Bench <number>" are added over one connection (100000 by default, 0 to skip).
+// Each command is picked at random: 60% SEARCH for about ten of the prefilled users, 10% a page of 10 from LIST SORTED,
+// 20% ADD of a new user and 10% DEL of one the same client added earlier
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+int connectTo(const char* path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path, sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        std::perror("connect");
+        std::exit(1);
+    }
+    return fd;
+}
+
+void sendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t written = send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (written <= 0) {
+            std::perror("send");
+            std::exit(1);
+        }
+        sent += written;
+    }
+}
+
+// One connection and what is left over of the last line it was sent
+struct Client {
+    int fd;
+    int id;
+    std::string partial = {};
+    // the users this client added and has not deleted yet
+    std::deque<int> added = {};
+    int nextUser = 0;
+};
+
+// reads until count status lines have come back and returns how many of them were errors
+size_t readAnswers(Client& client, size_t count) {
+    char buffer[1 << 16];
+    size_t errors = 0;
+    while (count > 0) {
+        ssize_t received = read(client.fd, buffer, sizeof(buffer));
+        if (received <= 0) {
+            std::fprintf(stderr, "the server closed a connection\n");
+            std::exit(1);
+        }
+        client.partial.append(buffer, received);
+
+        size_t start = 0;
+        size_t end;
+        while (count > 0 && (end = client.partial.find('\n', start)) != std::string::npos) {
+            std::string_view line(client.partial.data() + start, end - start);
+            if (line.starts_with("OK")) {
+                count--;
+            } else if (line.starts_with("ERROR")) {
+                count--;
+                errors++;
+            }
+            start = end + 1;
+        }
+        client.partial.erase(0, start);
+    }
+    return errors;
+}
+
+void appendCommand(std::string& out, Client& client, std::mt19937& random, size_t prefill) {
+    char line[128];
+    unsigned pick = random() % 100;
+    if (pick < 20 || (pick >= 90 && client.added.empty())) {
+        int user = client.nextUser++;
+        std::snprintf(line, sizeof(line), "ADD\tClient %d %d\t(202) %03d-%04d\n", client.id, user, 200 + client.id % 800, user % 10000);
+        client.added.push_back(user);
+    } else if (pick >= 90) {
+        std::snprintf(line, sizeof(line), "DEL\tNAME\tClient %d %d\n", client.id, client.added.front());
+        client.added.pop_front();
+    } else if (pick >= 80) {
+        std::snprintf(line, sizeof(line), "LIST\tSORTED\t%zu\t10\n", prefill ? size_t(random()) % prefill : 0);
+    } else {
+        // four digits match "Bench 1234", "Bench 12340" to "Bench 12349" and so on, about ten users
+        std::snprintf(line, sizeof(line), "SEARCH\tBench %u\n", 1000 + unsigned(random()) % 9000);
+    }
+    out += line;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s socket [clients] [seconds] [depth] [threads] [prefill]\n", argv[0]);
+        return 1;
+    }
+    const char* path = argv[1];
+    size_t clients = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 200;
+    double seconds = argc > 3 ? std::strtod(argv[3], nullptr) : 5;
+    size_t depth = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 8;
+    size_t threads = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 4;
+    size_t prefill = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 100000;
+    threads = std::clamp<size_t>(threads, 1, clients);
+
+    if (prefill) {
+        Client loader{connectTo(path), -1};
+        std::string batch;
+        char line[96];
+        for (size_t i = 0; i < prefill; i++) {
+            std::snprintf(line, sizeof(line), "ADD\tBench %zu\t(303) %03zu-%04zu\n", i, 200 + (i / 10000) % 800, i % 10000);
+            batch += line;
+            if ((i + 1) % 1000 == 0 || i + 1 == prefill) {
+                sendAll(loader.fd, batch);
+                readAnswers(loader, (i % 1000) + 1);
+                batch.clear();
+            }
+        }
+        close(loader.fd);
+    }
+
+    std::atomic<size_t> answered = 0;
+    std::atomic<size_t> errors = 0;
+    std::vector<std::vector<double>> latencies(threads);
+    auto stopAt = Clock::now() + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    auto start = Clock::now();
+
+    // Each thread sends depth commands to every one of its clients, then reads all the answers, and repeats.
+    // The latency is from sending a client its commands to having all of their answers
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            std::mt19937 random(t + 1);
+            std::vector<Client> mine;
+            for (size_t c = t; c < clients; c += threads) mine.push_back(Client{connectTo(path), int(c)});
+            std::vector<Clock::time_point> sentAt(mine.size());
+
+            std::string commands;
+            while (Clock::now() < stopAt) {
+                for (size_t c = 0; c < mine.size(); c++) {
+                    commands.clear();
+                    for (size_t i = 0; i < depth; i++) appendCommand(commands, mine[c], random, prefill);
+                    sentAt[c] = Clock::now();
+                    sendAll(mine[c].fd, commands);
+                }
+                for (size_t c = 0; c < mine.size(); c++) {
+                    errors += readAnswers(mine[c], depth);
+                    latencies[t].push_back(std::chrono::duration<double, std::micro>(Clock::now() - sentAt[c]).count());
+                    answered += depth;
+                }
+            }
+            for (Client& client : mine) close(client.fd);
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<double> all;
+    for (auto& some : latencies) all.insert(all.end(), some.begin(), some.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double fraction) { return all.empty() ? 0.0 : all[std::min(all.size() - 1, size_t(fraction * all.size()))]; };
+
+    std::printf("%8s %6s %12s %10s %14s %12s %12s\n", "clients", "depth", "commands", "errors", "commands/s", "p50 us", "p99 us");
+    std::printf("%8zu %6zu %12zu %10zu %14.0f %12.0f %12.0f\n", clients, depth, answered.load(), errors.load(), answered / elapsed, percentile(0.5), percentile(0.99));
+    return 0;
+}
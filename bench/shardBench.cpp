@@ -0,0 +1,69 @@
+// Measures how ADD and DEL from several threads at once scale with the number of shards in a ShardedUserStore
+// Every thread adds its own users and deletes every other one, holding the name's shard lock for each change the
+// same way the server does. With one shard every change waits on the same lock
+//
+// Build from the repository root with:
+// g++ bench/shardBench.cpp shardedUserStore.cpp userStore.cpp stringPool.cpp nameIndex.cpp phoneNumber.cpp -I. -std=c++20 -O2 -pthread -o shardBench.out
+//
+// ./shardBench.out [usersPerThread] [maxThreads] [maxShards]   (defaults to 200000, the number of cores and 64)
+// Threads and shards both go up in powers of two
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "shardedUserStore.hpp"
+
+int main(int argc, char* argv[]) {
+    size_t usersPerThread = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    size_t maxThreads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    size_t maxShards = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 64;
+
+    // the names and phone numbers are made before timing so only the store is measured
+    std::vector<std::vector<std::pair<std::string, PhoneNumber>>> users(maxThreads);
+    for (size_t t = 0; t < maxThreads; t++) {
+        char phone[32];
+        for (size_t i = 0; i < usersPerThread; i++) {
+            std::snprintf(phone, sizeof(phone), "(%03zu) %03zu-%04zu", 200 + t % 800, 200 + (i / 10000) % 800, i % 10000);
+            PhoneNumber phoneNumber;
+            parsePhoneNumber(phone, phoneNumber);
+            users[t].emplace_back("User " + std::to_string(t) + " " + std::to_string(i), phoneNumber);
+        }
+    }
+
+    std::printf("%8s %8s %14s %14s\n", "shards", "threads", "changes/s", "ns/change");
+
+    for (size_t shards = 1; shards <= maxShards; shards *= 2) {
+        for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+            ShardedUserStore store(shards);
+
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < threads; t++) {
+                workers.emplace_back([&store, &mine = users[t]] {
+                    for (size_t i = 0; i < mine.size(); i++) {
+                        {
+                            auto lock = store.lockName(mine[i].first);
+                            store.insert(mine[i].first, mine[i].second);
+                        }
+                        // deletes the user added just before this one, so the store keeps growing but also sees erases
+                        if (i % 2 == 1) {
+                            auto lock = store.lockName(mine[i - 1].first);
+                            store.erase(mine[i - 1].first, mine[i - 1].second);
+                        }
+                    }
+                });
+            }
+            for (auto& worker : workers) worker.join();
+            auto stop = std::chrono::steady_clock::now();
+
+            double seconds = std::chrono::duration<double>(stop - start).count();
+            double changes = threads * (usersPerThread + usersPerThread / 2);
+            std::printf("%8zu %8zu %14.0f %14.1f\n", store.shardCount(), threads, changes / seconds, seconds * 1e9 / changes);
+        }
+    }
+    return 0;
+}
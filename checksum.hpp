@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// FNV-1a over 32 bit words, used to catch corrupt or half written files
+// Anything it is given must be a multiple of 4 bytes long, any extra bytes at the end are ignored
+class Checksum {
+public:
+    void add(const void* data, size_t size) {
+        auto bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i + 4 <= size; i += 4) {
+            uint32_t word;
+            std::memcpy(&word, bytes + i, 4);
+            Hash = (Hash ^ word) * 0x100000001b3;
+        }
+    }
+    uint64_t value() const { return Hash; }
+
+private:
+    uint64_t Hash = 0xcbf29ce484222325;
+};
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// One T that copies share until one of them changes it
+//
+// Copying only counts one more owner, and changing it through mutate() copies the T first if anything else still
+// has it, so a copy never sees the change. That is how the stores take a snapshot to read while they keep changing.
+// The last owner to let go frees it, on whatever thread that is. Copies can be read and dropped on any thread while
+// the original changes, but making a copy has to be kept apart from changing the original, which the stores do with
+// their locks
+template<typename T>
+class Cow {
+public:
+    Cow() : Box(new Shared{}) {}
+    explicit Cow(T value) : Box(new Shared{1, std::move(value)}) {}
+    Cow(const Cow& other) : Box(other.Box) { Box->references.fetch_add(1, std::memory_order_relaxed); }
+    Cow(Cow&& other) noexcept : Box(std::exchange(other.Box, nullptr)) {}
+    Cow& operator=(Cow other) noexcept {
+        std::swap(Box, other.Box);
+        return *this;
+    }
+    ~Cow() {
+        if (Box && Box->references.fetch_sub(1, std::memory_order_acq_rel) == 1) delete Box;
+    }
+
+    const T& operator*() const { return Box->value; }
+    const T* operator->() const { return &Box->value; }
+
+    // The T to change, copied first if anything else has it. The count is read with acquire so whatever an owner
+    // that just let go read happened before the change
+    T& mutate() {
+        if (Box->references.load(std::memory_order_acquire) != 1) *this = Cow(Box->value);
+        return Box->value;
+    }
+    // The T to change without copying it, only for changes no copy can see, like writing past the end of every copy
+    T& inPlace() { return Box->value; }
+
+private:
+    struct Shared {
+        std::atomic<uint32_t> references = 1;
+        T value;
+    };
+    Shared* Box;
+};
+
+// A vector in fixed size chunks that copies share until one of them changes a chunk
+//
+// Copying one only copies the pointers to its chunks, and changing an element copies just its chunk if a copy still
+// has it. Adding to the end writes past the end of every copy, so it never copies a chunk, and a vector that nothing
+// has copied never copies anything. The same rules about threads as for Cow apply
+template<typename T, size_t ChunkSize = 1024>
+class CowVector {
+public:
+    const T& operator[](size_t i) const { return (*Chunks[i / ChunkSize])[i % ChunkSize]; }
+    // the element at i to change, copying its chunk first if a copy of the vector still has it
+    T& mutate(size_t i) { return Chunks[i / ChunkSize].mutate()[i % ChunkSize]; }
+
+    void push_back(const T& value) {
+        if (Size == Chunks.size() * ChunkSize) Chunks.emplace_back();
+        Chunks.back().inPlace()[Size % ChunkSize] = value;
+        Size++;
+    }
+    // only ever grows, and the new elements are T{}
+    void resize(size_t size) {
+        while (Size < size) push_back(T{});
+    }
+    void reserve(size_t size) { Chunks.reserve((size + ChunkSize - 1) / ChunkSize); }
+    void clear() {
+        Chunks.clear();
+        Size = 0;
+    }
+
+    size_t size() const { return Size; }
+    bool empty() const { return Size == 0; }
+    // counts chunks shared with copies as well
+    size_t memoryUsage() const { return Chunks.capacity() * sizeof(Cow<Chunk>) + Chunks.size() * sizeof(Chunk); }
+
+private:
+    using Chunk = std::array<T, ChunkSize>;
+
+    std::vector<Cow<Chunk>> Chunks;
+    size_t Size = 0;
+};
@@ -1,31 +1,102 @@
+#include <algorithm>
+#include <charconv>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <fstream>
-#include <codecvt>
-#include <locale>
 #include <list>
-#include <regex>
+#include <span>
 
 #include "user.hpp"
-#include "uninorms.h"
+#include "shardedUserStore.hpp"
+#include "utf8.hpp"
+#include "validator.hpp"
+#include "mappedFile.hpp"
+#include "snapshot.hpp"
+#include "journal.hpp"
+#include "stats.hpp"
+
+// The buffers one stream of commands reuses between commands, so several streams can run at once
+struct CommandBuffers {
+    std::u32string name;
+    std::string nameUTF8;
+};
+
+// What happened to an ADD, DEL or LOAD. Unlogged means the change was made but could not be written to the
+// journal yet, so it would be lost if the program stopped now. See journal.hpp
+enum class Change { Made, Refused, Unlogged };
 
 class Database {
 public:
-    Database() = default;
+    // The users are split into this many shards so the server can change users with different names at the same
+    // time. See shardedUserStore.hpp
+    explicit Database(size_t shards = 1) : Users(shards) {}
     void populateFromFile(std::ifstream& file);
+    // Memory maps the file instead of reading it line by line. Returns false if it could not be opened
+    // With more than one thread the users are validated in parallel but still added in the order they are in the file
+    bool loadFile(const char* path, unsigned threads = 1);
+    // Validates text files of users that may be bigger than memory and writes the users in them to a snapshot at
+    // output, reporting duplicates as it goes but adding nothing to the database. It uses about memLimit bytes
+    // however big the files are. Returns false if a file could not be read or written. See externalImport.cpp
+    bool importExternal(std::span<char* const> paths, const char* output, size_t memLimit);
     bool getCommand();
+    // Runs the commands in a script file with no prompts. See script.cpp for the format
+    // Returns false if the script could not be opened
+    bool runScript(const char* path);
+    // Runs one line of a script and appends its output to out. Returns false for EXIT
+    // A huge listing is written to spill early instead of growing out without limit, unless spill is null
+    bool runCommand(std::string_view line, std::string& out, CommandBuffers& buffers, std::ostream* spill);
+    // Accepts clients on a Unix domain socket at path that send the same commands as a script. See server.cpp
+    // Runs until the program gets SIGINT or SIGTERM. Returns false if the socket could not be set up
+    bool serve(const char* path, unsigned threads);
+    // Writes every user to a binary snapshot, or replaces every user with the ones in one. See snapshot.hpp
+    bool saveSnapshot(const char* path);
+    // Refused if the snapshot could not be read
+    Change loadSnapshot(const char* path);
+    // Replays the journal on top of the users already loaded and then logs every change made after this
+    // Returns false if the journal could not be opened. See journal.hpp
+    bool openJournal(const char* path, const JournalOptions& options);
+    // Writes the same table as the STATS command to standard error, so it does not mix with the output of a script
+    void printStats() const;
 
 private:
-    std::list<User> Users;
+    ShardedUserStore Users;
+    Journal Log;
+    // the store keeps names in UTF-8, so a name is encoded into this before it is added or looked up
+    std::string NameUTF8;
+    // counts and times the imports and commands for STATS
+    Stats Statistics;
 
     void clean(std::string& str);
-    std::u32string normalizeToUTF32(const std::string& str) const;
+    void importUser(std::string_view nameLine, std::string_view phoneLine, std::u32string& name, StageTimer& timer);
+    void importParallel(std::string_view contents, unsigned threads);
+    void addImportedUser(std::u32string_view name, const PhoneNumber& phoneNumber);
     std::string u32ToString(const std::u32string &str) const;
-    bool validateName(std::u32string& name) const;
-    bool validatePhoneNumber(std::string& phoneNumber) const;
+    // Normalize and validate a name or phone number typed into ADD or DEL and count why it was rejected, if it was
+    // position is which character of the normalized name is not allowed, or npos
+    RejectReason checkName(std::string_view input, std::u32string& name, size_t& position);
+    RejectReason checkPhoneNumber(std::string_view input, PhoneNumber& phoneNumber);
+    // every ADD and DEL goes through these so the change is also written to the journal
+    // The name is the normalized name in UTF-8, and the shard with the user has to be locked when there are other threads
+    // An add is refused if the user already exists
+    Change insertUser(std::string_view name, const PhoneNumber& phoneNumber);
+    Change eraseUser(UserStore::const_iterator user);
+    // Rewrites the journal if the changes have made it too big. It reads every shard, so it is called once a change
+    // has let go of its lock
+    void compactJournal();
+    // The users as they are now, to list or save while other threads keep changing them. The shards are only locked
+    // while it is taken. With sorted the names are sorted first if they were not already
+    ShardedUserStore snapshotUsers(bool sorted);
+    // true if the field is nothing but a number, used for the LIST offset and count
+    static bool parseNumber(std::string_view field, size_t& number);
 
     void add();
     void del();
-    void list();
+    // LIST [SORTED] [offset count]
+    void list(std::string_view arguments);
+    void search();
+    void stats();
+    void save();
+    void load();
 };
\ No newline at end of file
@@ -0,0 +1,373 @@
+#include "database.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <utility>
+
+// An import for input files that are bigger than the memory it is allowed to use
+//
+// Nothing is added to the database. Every user is validated and normalized as usual and packed into a buffer, and
+// when the buffer is full it is sorted by name and phone number and written to a temporary file as a run. The runs
+// are then merged, as many at a time as the limit allows, so equal users come out next to each other and every one
+// after the first is reported as a duplicate. The users that are left are written straight into a snapshot, which can
+// be loaded like any other. The runs and the merge each use about memLimit bytes, however big the input is
+
+namespace {
+
+constexpr size_t BatchSize = 4096;
+// what the limit does not give to the run buffer: the validator's batch and the buffers of the files being written
+constexpr size_t Overhead = 4 << 20;
+constexpr size_t MinimumMemLimit = 2 * Overhead;
+// how much of each run is read at a time while merging
+constexpr size_t MergeBuffer = 256 << 10;
+// keeps the open runs well under the usual limit of 1024 open files
+constexpr size_t MaxFanIn = 512;
+
+// A user in a run is the name and phone number lengths as 32 bit numbers followed by the name and the phone number,
+// with no padding. The phone number is the 16 bytes of its PhoneNumber, the same as in a snapshot, so two users are
+// the same exactly when their bytes are
+struct RecordView {
+    std::string_view name;
+    std::string_view phoneNumber;
+};
+
+RecordView recordAt(const char* data) {
+    uint32_t lengths[2];
+    std::memcpy(lengths, data, sizeof(lengths));
+    return {{data + 8, lengths[0]}, {data + 8 + lengths[0], lengths[1]}};
+}
+
+// the order names are listed in, then the phone numbers
+bool operator<(const RecordView& a, const RecordView& b) {
+    int order = a.name.compare(b.name);
+    return order < 0 || (order == 0 && a.phoneNumber < b.phoneNumber);
+}
+bool operator==(const RecordView& a, const RecordView& b) { return a.name == b.name && a.phoneNumber == b.phoneNumber; }
+
+bool writeRecord(std::FILE* file, const RecordView& record) {
+    uint32_t lengths[2] = {uint32_t(record.name.size()), uint32_t(record.phoneNumber.size())};
+    return std::fwrite(lengths, sizeof(lengths), 1, file) == 1
+        && std::fwrite(record.name.data(), 1, record.name.size(), file) == record.name.size()
+        && std::fwrite(record.phoneNumber.data(), 1, record.phoneNumber.size(), file) == record.phoneNumber.size();
+}
+
+// The users that have been validated but not written to a run yet, packed back to back
+// Sorting moves a small entry for each user rather than the users. The entry starts with the first 8 bytes of the
+// name so most comparisons never look at the users at all
+class RunBuffer {
+public:
+    explicit RunBuffer(size_t bytes) {
+        // about 40 bytes per user for the packed user and 16 for its entry
+        Data.reserve(bytes / 3 * 2);
+        Entries.reserve(bytes / 3 / sizeof(Entry));
+    }
+
+    bool empty() const { return Entries.empty(); }
+    // whether a user with this name and phone number would not fit. An empty buffer takes any user, however long
+    bool full(std::string_view name, std::string_view phoneNumber) const {
+        return !empty() && (Entries.size() == Entries.capacity() || Data.size() + 8 + name.size() + phoneNumber.size() > Data.capacity());
+    }
+
+    void add(std::string_view name, std::string_view phoneNumber) {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < 8; i++) prefix = prefix << 8 | (i < name.size() ? uint8_t(name[i]) : 0);
+        Entries.push_back({prefix, Data.size()});
+
+        uint32_t lengths[2] = {uint32_t(name.size()), uint32_t(phoneNumber.size())};
+        Data.append(reinterpret_cast<const char*>(lengths), sizeof(lengths));
+        Data += name;
+        Data += phoneNumber;
+    }
+
+    // Sorts the users and passes each one to emit in order, or to duplicate if it is the same as the one before
+    // The buffer is empty afterwards
+    template<typename Emit, typename Duplicate>
+    void drain(Emit&& emit, Duplicate&& duplicate) {
+        // names that differ in their first 8 bytes are in the same order as their prefixes, since a shorter name is
+        // padded with zeros, which no byte comes before
+        std::sort(Entries.begin(), Entries.end(), [this](const Entry& a, const Entry& b) {
+            if (a.prefix != b.prefix) return a.prefix < b.prefix;
+            return recordAt(Data.data() + a.offset) < recordAt(Data.data() + b.offset);
+        });
+
+        for (size_t i = 0; i < Entries.size(); i++) {
+            RecordView record = recordAt(Data.data() + Entries[i].offset);
+            if (i > 0 && record == recordAt(Data.data() + Entries[i - 1].offset)) duplicate(record);
+            else emit(record);
+        }
+
+        Entries.clear();
+        Data.clear();
+    }
+
+private:
+    struct Entry {
+        uint64_t prefix;
+        size_t offset;
+    };
+
+    std::string Data;
+    std::vector<Entry> Entries;
+};
+
+// Reads one run a user at a time
+class RunReader {
+public:
+    RunReader() = default;
+    RunReader(const RunReader&) = delete;
+    RunReader& operator=(const RunReader&) = delete;
+    ~RunReader() {
+        if (File) std::fclose(File);
+    }
+
+    // opens the run and reads its first user
+    bool open(const std::string& path, size_t bufferSize) {
+        File = std::fopen(path.c_str(), "rb");
+        if (!File) return false;
+        Buffer.resize(bufferSize);
+        std::setvbuf(File, Buffer.data(), _IOFBF, Buffer.size());
+        next();
+        return !Failed;
+    }
+
+    // Moves on to the next user. Returns false at the end of the run, or if the run is cut short
+    bool next() {
+        uint32_t lengths[2];
+        size_t read = std::fread(lengths, 1, sizeof(lengths), File);
+        if (read != sizeof(lengths)) {
+            Failed = read != 0 || std::ferror(File);
+            Done = true;
+            return false;
+        }
+        Name.resize(lengths[0]);
+        Phone.resize(lengths[1]);
+        if (std::fread(Name.data(), 1, Name.size(), File) != Name.size() || std::fread(Phone.data(), 1, Phone.size(), File) != Phone.size()) {
+            Failed = Done = true;
+            return false;
+        }
+        return true;
+    }
+
+    bool done() const { return Done; }
+    bool failed() const { return Failed; }
+    RecordView record() const { return {Name, Phone}; }
+
+private:
+    std::FILE* File = nullptr;
+    std::vector<char> Buffer;
+    std::string Name;
+    std::string Phone;
+    bool Done = false;
+    bool Failed = false;
+};
+
+// Merges sorted runs into one sorted stream, passing every user to emit once and every copy after that to duplicate
+// Returns false if a run could not be read
+template<typename Emit, typename Duplicate>
+bool mergeRuns(std::span<const std::string> paths, size_t bufferSize, Emit&& emit, Duplicate&& duplicate) {
+    std::deque<RunReader> runs(paths.size());
+    // a min heap of the runs by the user each one is on
+    std::vector<RunReader*> heap;
+    auto after = [](const RunReader* a, const RunReader* b) { return b->record() < a->record(); };
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (!runs[i].open(paths[i], bufferSize)) return false;
+        if (!runs[i].done()) heap.push_back(&runs[i]);
+    }
+    std::make_heap(heap.begin(), heap.end(), after);
+
+    // the last user emitted, copied since the run it came from moves on
+    std::string lastName;
+    std::string lastPhone;
+    bool first = true;
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), after);
+        RunReader* run = heap.back();
+        RecordView record = run->record();
+        if (!first && record == RecordView{lastName, lastPhone}) {
+            duplicate(record);
+        } else {
+            emit(record);
+            lastName = record.name;
+            lastPhone = record.phoneNumber;
+            first = false;
+        }
+
+        if (run->next()) std::push_heap(heap.begin(), heap.end(), after);
+        else if (run->failed()) return false;
+        else heap.pop_back();
+    }
+    return true;
+}
+
+// The temporary runs, named after the output file. Any left when this goes out of scope are removed
+class RunFiles {
+public:
+    explicit RunFiles(std::string prefix) : Prefix(std::move(prefix)) {}
+    RunFiles(const RunFiles&) = delete;
+    RunFiles& operator=(const RunFiles&) = delete;
+    ~RunFiles() { remove(Paths.size()); }
+
+    // the path for a new run, added to the end
+    const std::string& add() { return Paths.emplace_back(Prefix + ".run" + std::to_string(Made++)); }
+    // removes the first count runs
+    void remove(size_t count) {
+        for (size_t i = 0; i < count; i++) std::remove(Paths[i].c_str());
+        Paths.erase(Paths.begin(), Paths.begin() + count);
+    }
+
+    std::span<const std::string> paths() const { return Paths; }
+    size_t size() const { return Paths.size(); }
+
+private:
+    std::string Prefix;
+    std::vector<std::string> Paths;
+    size_t Made = 0;
+};
+
+// Opens a file to write a run to with a big buffer, closing it when it goes out of scope
+class RunWriter {
+public:
+    RunWriter() = default;
+    RunWriter(const RunWriter&) = delete;
+    RunWriter& operator=(const RunWriter&) = delete;
+    ~RunWriter() { close(); }
+
+    bool open(const std::string& path) {
+        File = std::fopen(path.c_str(), "wb");
+        if (!File) return false;
+        Buffer.resize(1 << 20);
+        std::setvbuf(File, Buffer.data(), _IOFBF, Buffer.size());
+        Ok = true;
+        return true;
+    }
+    void add(const RecordView& record) { Ok = Ok && writeRecord(File, record); }
+    // returns false if anything could not be written
+    bool close() {
+        if (!File) return Ok;
+        Ok = (std::fclose(File) == 0) && Ok;
+        File = nullptr;
+        return Ok;
+    }
+
+private:
+    std::FILE* File = nullptr;
+    std::vector<char> Buffer;
+    bool Ok = false;
+};
+
+} // namespace
+
+bool Database::importExternal(std::span<char* const> paths, const char* output, size_t memLimit) {
+    memLimit = std::max(memLimit, MinimumMemLimit);
+
+    // the duplicates are printed with \n rather than std::endl, since there can be millions of them
+    auto duplicate = [this](const RecordView& record) {
+        Statistics.countDuplicate();
+        std::cout << "User " << record.name << " already exists\n";
+    };
+
+    RunFiles runs(output);
+    SnapshotWriter snapshot;
+    // the users come out of the merge sorted by name, so the snapshot only has to compare each name with the last
+    if (!snapshot.open(output, true)) {
+        std::cout << "Unable to write " << output << std::endl;
+        return false;
+    }
+    auto accept = [&](const RecordView& record) {
+        Statistics.countAccepted();
+        PhoneNumber phoneNumber;
+        std::memcpy(&phoneNumber, record.phoneNumber.data(), sizeof(phoneNumber));
+        snapshot.add(record.name, phoneNumber);
+    };
+
+    {
+        RunBuffer buffer(memLimit - Overhead);
+        auto writeRun = [&] {
+            RunWriter run;
+            if (!run.open(runs.add())) return false;
+            buffer.drain([&](const RecordView& record) { run.add(record); }, duplicate);
+            return run.close();
+        };
+
+        Validator validator;
+        std::vector<UserRecord> records;
+        records.reserve(BatchSize);
+        std::string name;
+        for (char* path : paths) {
+            MappedFile file;
+            if (!file.open(path)) {
+                std::cout << "The file " << path << " could not be opened" << std::endl;
+                return false;
+            }
+            std::string_view contents = file.contents();
+            if (isSnapshot(contents)) {
+                std::cout << path << " is a snapshot. Only text files of users can be imported with --mem-limit" << std::endl;
+                return false;
+            }
+
+            std::cout << "Sorting users from " << path << " ..." << std::endl;
+            while (!contents.empty()) {
+                records.clear();
+                while (!contents.empty() && records.size() < BatchSize) {
+                    std::string_view nameLine = takeLine(contents);
+                    records.push_back({nameLine, takeLine(contents)});
+                }
+
+                auto start = Stats::Clock::now();
+                std::span<const ValidationResult> results = validator.validate(records);
+                Statistics.time(ImportStage::ValidateBatch, Stats::Clock::now() - start);
+
+                for (const auto& result : results) {
+                    Statistics.countRecord();
+                    if (result.reason != RejectReason::None) {
+                        Statistics.countRejection(result.reason);
+                        continue;
+                    }
+                    encodeUTF8(validator.name(result), name);
+                    std::string_view phoneNumber(reinterpret_cast<const char*>(&result.phoneNumber), sizeof(PhoneNumber));
+                    if (buffer.full(name, phoneNumber) && !writeRun()) {
+                        std::cout << "Unable to write a temporary run next to " << output << std::endl;
+                        return false;
+                    }
+                    buffer.add(name, phoneNumber);
+                }
+            }
+        }
+
+        // if every user fit in the buffer they go straight into the snapshot without a run
+        if (runs.size() == 0) {
+            buffer.drain(accept, duplicate);
+        } else if (!buffer.empty() && !writeRun()) {
+            std::cout << "Unable to write a temporary run next to " << output << std::endl;
+            return false;
+        }
+    }
+
+    // the buffer is gone by now, so the memory goes to reading the runs. With more runs than can be read at once,
+    // the first ones are merged into a new run at the end until there are few enough
+    size_t fanIn = std::clamp((memLimit - Overhead) / MergeBuffer, size_t(2), MaxFanIn);
+    if (runs.size() > 0) std::cout << "Merging " << runs.size() << " runs ..." << std::endl;
+    while (runs.size() > fanIn) {
+        RunWriter merged;
+        bool ok = merged.open(runs.add());
+        ok = ok && mergeRuns(runs.paths().first(fanIn), MergeBuffer, [&](const RecordView& record) { merged.add(record); }, duplicate);
+        if (!merged.close() || !ok) {
+            std::cout << "Unable to merge the temporary runs next to " << output << std::endl;
+            return false;
+        }
+        runs.remove(fanIn);
+    }
+
+    bool ok = mergeRuns(runs.paths(), MergeBuffer, accept, duplicate);
+    runs.remove(runs.size());
+    if (!ok || !snapshot.finish()) {
+        std::cout << "Unable to write " << output << std::endl;
+        return false;
+    }
+
+    std::cout << "Wrote " << snapshot.count() << " users to " << output << '\n' << std::endl;
+    return true;
+}
@@ -0,0 +1,118 @@
+#include "database.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// The parallel import is split into three stages
+// The reader thread cuts the file into batches of users, a pool of workers normalizes and validates whole batches at once,
+// and the calling thread merges finished batches into the database strictly in file order.
+// Merging in order means duplicates are found and reported exactly as they would be by the single threaded import
+
+namespace {
+
+constexpr size_t BatchSize = 4096;
+
+struct ImportBatch {
+    // the name and phone number lines in the mapped file
+    std::vector<UserRecord> records;
+    // filled in by whichever worker picks the batch up
+    Validator validator;
+    std::span<const ValidationResult> results;
+    bool done = false;
+};
+
+} // namespace
+
+void Database::importParallel(std::string_view contents, unsigned threads) {
+    std::mutex lock;
+    std::condition_variable workReady;
+    std::condition_variable batchDone;
+    std::condition_variable spaceFree;
+
+    // every batch that has been read but not merged, in file order. The front is the next one to merge
+    std::deque<std::unique_ptr<ImportBatch>> inFlight;
+    // batches that no worker has picked up yet
+    std::deque<ImportBatch*> work;
+    bool readerFinished = false;
+
+    // limits how far the reader can get ahead of the merge so memory stays bounded on huge files
+    const size_t maxInFlight = threads * 4;
+
+    std::thread reader([&] {
+        while (!contents.empty()) {
+            auto batch = std::make_unique<ImportBatch>();
+            batch->records.reserve(BatchSize);
+            while (!contents.empty() && batch->records.size() < BatchSize) {
+                std::string_view name = takeLine(contents);
+                batch->records.push_back({name, takeLine(contents)});
+            }
+
+            std::unique_lock guard(lock);
+            spaceFree.wait(guard, [&] { return inFlight.size() < maxInFlight; });
+            work.push_back(batch.get());
+            inFlight.push_back(std::move(batch));
+            workReady.notify_one();
+        }
+
+        std::lock_guard guard(lock);
+        readerFinished = true;
+        workReady.notify_all();
+        batchDone.notify_all();
+    });
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 0; i < threads; i++) {
+        workers.emplace_back([&] {
+            while (true) {
+                ImportBatch* batch;
+                {
+                    std::unique_lock guard(lock);
+                    workReady.wait(guard, [&] { return !work.empty() || readerFinished; });
+                    if (work.empty()) return;
+                    batch = work.front();
+                    work.pop_front();
+                }
+
+                auto start = Stats::Clock::now();
+                batch->results = batch->validator.validate(batch->records);
+                auto elapsed = Stats::Clock::now() - start;
+
+                std::lock_guard guard(lock);
+                Statistics.time(ImportStage::ValidateBatch, elapsed);
+                batch->done = true;
+                batchDone.notify_all();
+            }
+        });
+    }
+
+    // merge stage
+    while (true) {
+        std::unique_ptr<ImportBatch> batch;
+        {
+            std::unique_lock guard(lock);
+            batchDone.wait(guard, [&] { return (!inFlight.empty() && inFlight.front()->done) || (inFlight.empty() && readerFinished); });
+            if (inFlight.empty()) break;
+            batch = std::move(inFlight.front());
+            inFlight.pop_front();
+            spaceFree.notify_one();
+        }
+
+        // only the insert happens on this thread, so that is the only stage timed per record
+        for (const auto& result : batch->results) {
+            StageTimer timer(Statistics, Statistics.timeNextRecord());
+            Statistics.countRecord();
+            if (result.reason != RejectReason::None) {
+                Statistics.countRejection(result.reason);
+                continue;
+            }
+            addImportedUser(batch->validator.name(result), result.phoneNumber);
+            timer.lap(ImportStage::Insert);
+        }
+    }
+
+    reader.join();
+    for (auto& worker : workers) worker.join();
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "cow.hpp"
+
+// The same idea as StringPool for small fixed size values like a PhoneNumber
+// Every distinct value is stored once and named by a dense 32 bit handle in the order it was added
+template<typename T, typename Hash = std::hash<T>>
+class InternPool {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle None = UINT32_MAX;
+
+    // returns the handle of an equal value if there already is one, otherwise adds it
+    Handle intern(const T& value) {
+        if ((Values.size() + 1) * 2 > Table.size()) rehash(Table.empty() ? 64 : Table.size() * 2);
+
+        size_t i = slot(value);
+        if (Table[i] != None) return Table[i];
+
+        Handle handle = Values.size();
+        Values.push_back(value);
+        Table[i] = handle;
+        return handle;
+    }
+
+    // returns None if the value is not in the pool
+    Handle find(const T& value) const {
+        if (Table.empty()) return None;
+        return Table[slot(value)];
+    }
+
+    const T& get(Handle handle) const { return Values[handle]; }
+    // a copy that shares every value with this pool, the same as StringPool::snapshot
+    InternPool snapshot() const {
+        InternPool copy;
+        copy.Values = Values;
+        return copy;
+    }
+
+    size_t size() const { return Values.size(); }
+
+    void reserve(size_t count) {
+        Values.reserve(count);
+        size_t size = Table.empty() ? 64 : Table.size();
+        while (size < count * 2) size *= 2;
+        if (size != Table.size()) rehash(size);
+    }
+
+    void clear() {
+        Values.clear();
+        Table.clear();
+    }
+
+    size_t memoryUsage() const { return Values.memoryUsage() + Table.capacity() * sizeof(Handle); }
+
+private:
+    CowVector<T> Values;
+    // open addressing with linear probing, each slot is a handle or None. Always a power of 2 and at most half full
+    std::vector<Handle> Table;
+
+    // the slot holding an equal value, or the empty slot where it would go
+    size_t slot(const T& value) const {
+        size_t mask = Table.size() - 1;
+        for (size_t i = Hash{}(value) & mask;; i = (i + 1) & mask) {
+            if (Table[i] == None || Values[Table[i]] == value) return i;
+        }
+    }
+
+    void rehash(size_t size) {
+        Table.assign(size, None);
+        size_t mask = size - 1;
+        for (Handle handle = 0; handle < Values.size(); handle++) {
+            size_t i = Hash{}(Values[handle]) & mask;
+            while (Table[i] != None) i = (i + 1) & mask;
+            Table[i] = handle;
+        }
+    }
+};
@@ -0,0 +1,288 @@
+#include "journal.hpp"
+#include "checksum.hpp"
+#include "mappedFile.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Every record is:
+//   uint32 payload length, uint32 checksum of the payload (the low half of Checksum)
+//   payload: uint8 op, 3 bytes of padding, and for add and delete the user in the same layout as a snapshot,
+//   a uint32 name length, the UTF-8 name padded to 4 bytes, a uint32 phone number length and the phone number padded to 4 bytes
+
+namespace {
+
+size_t paddedLength(size_t length) { return (length + 3) & ~size_t(3); }
+
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) return false;
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+// A rename is only on disk once the directory it happened in has been synced too
+bool syncDirectory(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+}
+
+} // namespace
+
+Journal::~Journal() {
+    if (!isOpen()) return;
+
+    {
+        std::lock_guard guard(Lock);
+        Stopping = true;
+        Wake.notify_all();
+    }
+    Flusher.join();
+
+    std::lock_guard guard(Lock);
+    if (!commitLocked()) {
+        // nothing is left to report it to, so at least whoever started the program knows
+        std::cerr << "The last " << PendingOps << " changes could not be written to the journal " << Path << std::endl;
+    }
+    ::close(Fd);
+}
+
+void Journal::encode(std::string& out, Op op, std::string_view name, const PhoneNumber& phoneNumber) {
+    // the phone number is kept as text so the journal does not depend on how PhoneNumber is packed
+    char phoneText[MaxPhoneNumberLength];
+    std::string_view phone(phoneText, op == Op::Reset ? 0 : phoneNumber.format(phoneText));
+
+    size_t start = out.size();
+    uint32_t payloadLength = 4;
+    if (op != Op::Reset) payloadLength += 4 + paddedLength(name.size()) + 4 + paddedLength(phone.size());
+
+    out.resize(start + 8 + payloadLength, 0);
+    char* record = out.data() + start;
+    char* payload = record + 8;
+
+    payload[0] = static_cast<char>(op);
+    if (op != Op::Reset) {
+        uint32_t nameLength = name.size();
+        uint32_t phoneLength = phone.size();
+        char* user = payload + 4;
+        std::memcpy(user, &nameLength, 4);
+        std::memcpy(user + 4, name.data(), nameLength);
+        user += 4 + paddedLength(nameLength);
+        std::memcpy(user, &phoneLength, 4);
+        std::memcpy(user + 4, phone.data(), phoneLength);
+    }
+
+    Checksum checksum;
+    checksum.add(payload, payloadLength);
+    uint32_t check = static_cast<uint32_t>(checksum.value());
+    std::memcpy(record, &payloadLength, 4);
+    std::memcpy(record + 4, &check, 4);
+}
+
+void Journal::encodeUsers(std::string& out, const ShardedUserStore& users) {
+    encode(out, Op::Reset);
+    users.forEach([&](const UserView& user) {
+        encode(out, Op::Add, user.name, user.phoneNumber);
+        return true;
+    });
+}
+
+bool Journal::open(const char* path, const JournalOptions& options, ShardedUserStore& users) {
+    Path = path;
+    Options = options;
+
+    // replay whatever is already there and remember where the last complete record ends
+    uint64_t validLength = 0;
+    {
+        MappedFile existing;
+        if (::access(path, F_OK) == 0 && !existing.open(path)) return false;
+
+        std::string_view contents = existing.contents();
+        while (contents.size() >= 8) {
+            uint32_t payloadLength, check;
+            std::memcpy(&payloadLength, contents.data(), 4);
+            std::memcpy(&check, contents.data() + 4, 4);
+            if (payloadLength < 4 || payloadLength % 4 || contents.size() - 8 < payloadLength) break;
+
+            const char* payload = contents.data() + 8;
+            Checksum checksum;
+            checksum.add(payload, payloadLength);
+            if (static_cast<uint32_t>(checksum.value()) != check) break;
+
+            Op op = static_cast<Op>(payload[0]);
+            if (op == Op::Reset) {
+                users.clear();
+            } else if (op == Op::Add || op == Op::Delete) {
+                // the lengths are covered by the checksum but are still checked against the record
+                uint32_t nameLength, phoneLength;
+                if (payloadLength < 8) break;
+                std::memcpy(&nameLength, payload + 4, 4);
+                size_t offset = 8 + paddedLength(nameLength);
+                if (nameLength > payloadLength || payloadLength < offset + 4) break;
+                std::memcpy(&phoneLength, payload + offset, 4);
+                offset += 4;
+                if (payloadLength - offset < paddedLength(phoneLength)) break;
+
+                std::string_view name(payload + 8, nameLength);
+                // only valid phone numbers are ever written so this can only fail if the record is damaged
+                PhoneNumber phoneNumber;
+                if (parsePhoneNumber(std::string_view(payload + offset, phoneLength), phoneNumber) != RejectReason::None) break;
+                if (op == Op::Add) {
+                    users.insert(name, phoneNumber);
+                } else {
+                    users.erase(name, phoneNumber);
+                }
+            } else {
+                break;
+            }
+
+            contents.remove_prefix(8 + payloadLength);
+            validLength += 8 + payloadLength;
+        }
+    }
+
+    Fd = ::open(path, O_WRONLY | O_CREAT, 0644);
+    if (Fd < 0) return false;
+
+    // cut off a record that was only partly written, new records are appended after the last good one
+    if (::ftruncate(Fd, validLength) < 0 || ::lseek(Fd, validLength, SEEK_SET) < 0) {
+        ::close(Fd);
+        Fd = -1;
+        return false;
+    }
+
+    Size = validLength;
+    CompactedSize = 0;
+    Flusher = std::thread(&Journal::flushLoop, this);
+    return true;
+}
+
+bool Journal::recordAdd(std::string_view name, const PhoneNumber& phoneNumber) {
+    return append(Op::Add, name, phoneNumber);
+}
+
+bool Journal::recordDelete(std::string_view name, const PhoneNumber& phoneNumber) {
+    return append(Op::Delete, name, phoneNumber);
+}
+
+bool Journal::recordReset(const ShardedUserStore& users) {
+    if (!isOpen() || compact(users)) return true;
+
+    // the journal could not be rewritten, so the users go on the end of it instead and are retried like any other change
+    std::lock_guard guard(Lock);
+    if (!PendingOps) FirstPending = std::chrono::steady_clock::now();
+    encodeUsers(Pending, users);
+    PendingOps += users.size() + 1;
+    return commitLocked();
+}
+
+bool Journal::append(Op op, std::string_view name, const PhoneNumber& phoneNumber) {
+    if (!isOpen()) return true;
+
+    std::lock_guard guard(Lock);
+    if (!PendingOps) FirstPending = std::chrono::steady_clock::now();
+    encode(Pending, op, name, phoneNumber);
+    PendingOps++;
+
+    // after a failure only the flusher tries again, so a full group does not retry on every change
+    if (PendingOps >= Options.groupCommitOps && !Failed) {
+        return commitLocked();
+    } else if (PendingOps == 1) {
+        // start the timer for this group
+        Wake.notify_all();
+    }
+    return !Failed;
+}
+
+bool Journal::commit() {
+    if (!isOpen()) return true;
+
+    std::lock_guard guard(Lock);
+    return commitLocked();
+}
+
+bool Journal::commitLocked() {
+    if (!PendingOps) return true;
+
+    // After a failure part of the group may be in the file, and a failed sync can leave its pages looking clean
+    // even though they never reached the disk. So the whole group is written again over it, starting where the last
+    // good group ended. Pending only grows until it is written, so nothing from the failed attempt is left past the end
+    if ((!Failed || ::lseek(Fd, Size, SEEK_SET) >= 0) && writeAll(Fd, Pending.data(), Pending.size()) && ::fdatasync(Fd) == 0) {
+        Size += Pending.size();
+        Pending.clear();
+        PendingOps = 0;
+        Failed = false;
+        return true;
+    }
+
+    Failed = true;
+    // tried again by the flusher once another groupCommitTime has gone by
+    FirstPending = std::chrono::steady_clock::now();
+    return false;
+}
+
+void Journal::flushLoop() {
+    std::unique_lock guard(Lock);
+    while (!Stopping) {
+        if (!PendingOps) {
+            Wake.wait(guard);
+            continue;
+        }
+
+        auto deadline = FirstPending + Options.groupCommitTime;
+        if (std::chrono::steady_clock::now() >= deadline) {
+            commitLocked();
+        } else {
+            Wake.wait_until(guard, deadline);
+        }
+    }
+}
+
+bool Journal::needsCompaction() const {
+    // compacting only once the journal has doubled since the last compaction keeps it from happening over and over
+    // when most of the journal is users that still exist
+    // Locked since the server asks from several threads while another may be compacting
+    std::lock_guard guard(Lock);
+    return isOpen() && Size > Options.compactBytes && Size > 2 * CompactedSize;
+}
+
+bool Journal::compact(const ShardedUserStore& users) {
+    if (!isOpen()) return false;
+
+    std::lock_guard guard(Lock);
+
+    std::string compacted;
+    encodeUsers(compacted, users);
+
+    // written next to the journal and renamed over it so a crash leaves either the old or the new journal
+    std::string temporary = Path + ".tmp";
+    int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    if (!writeAll(fd, compacted.data(), compacted.size()) || ::fsync(fd) != 0 || ::rename(temporary.c_str(), Path.c_str()) != 0) {
+        ::close(fd);
+        ::unlink(temporary.c_str());
+        return false;
+    }
+
+    // anything waiting is already part of users so it is in the compacted journal
+    Pending.clear();
+    PendingOps = 0;
+    Failed = false;
+
+    // the new journal is the one at Path now, so it is appended to even if the directory cannot be synced
+    ::close(Fd);
+    Fd = fd;
+    Size = compacted.size();
+    CompactedSize = compacted.size();
+    return syncDirectory(Path);
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "shardedUserStore.hpp"
+
+struct JournalOptions {
+    // changes are written and synced to disk once this many are waiting or the oldest has waited this long
+    size_t groupCommitOps = 64;
+    std::chrono::milliseconds groupCommitTime{10};
+    // once the journal is bigger than this it is rewritten to hold only the current users
+    uint64_t compactBytes = 64 << 20;
+};
+
+// An append only log of every ADD and DEL so changes survive the program exiting
+//
+// Changes are buffered and committed in groups with a single fsync, either every groupCommitOps changes
+// or every groupCommitTime, whichever comes first. A change that has not been committed yet is lost if the
+// program crashes, so at most one group of changes can be lost.
+//
+// Every record has its own length and checksum. A record that was only half written when the program
+// died is detected on the next start and cut off, and everything before it is kept.
+//
+// When the journal grows too big it is compacted into a single reset record followed by one add per current user.
+// The reset means a compacted journal no longer depends on the snapshot or input file it was started on.
+//
+// If a group cannot be written or synced it is not dropped. It stays waiting, the file is cut back to the end of the
+// last group that made it, and the whole group is written again after another groupCommitTime. Until that works
+// every change reports that it is not in the journal, so the command that made it can say so.
+class Journal {
+public:
+    Journal() = default;
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+    // commits anything still waiting
+    ~Journal();
+
+    // Replays the journal at path on top of users, then keeps it open to append to
+    // A journal that does not exist yet is created. Returns false if it could not be read or opened
+    bool open(const char* path, const JournalOptions& options, ShardedUserStore& users);
+    bool isOpen() const { return Fd >= 0; }
+
+    // Return false if the journal cannot be written at the moment. The change is kept and tried again with the next group
+    bool recordAdd(std::string_view name, const PhoneNumber& phoneNumber);
+    bool recordDelete(std::string_view name, const PhoneNumber& phoneNumber);
+    // the store was replaced as a whole, for example by loading a snapshot
+    bool recordReset(const ShardedUserStore& users);
+
+    // Rewrites the journal so it only holds the users that exist now
+    bool needsCompaction() const;
+    bool compact(const ShardedUserStore& users);
+
+    // Writes and syncs everything waiting right away. Returns false if it could not
+    bool commit();
+
+private:
+    enum class Op : uint8_t { Add = 1, Delete = 2, Reset = 3 };
+
+    static void encode(std::string& out, Op op, std::string_view name = {}, const PhoneNumber& phoneNumber = {});
+    // a reset record followed by an add for every user
+    static void encodeUsers(std::string& out, const ShardedUserStore& users);
+    bool append(Op op, std::string_view name, const PhoneNumber& phoneNumber);
+    bool commitLocked();
+    void flushLoop();
+
+    // swapped by compaction while other threads check isOpen
+    std::atomic<int> Fd = -1;
+    std::string Path;
+    JournalOptions Options;
+
+    mutable std::mutex Lock;
+    std::condition_variable Wake;
+    std::thread Flusher;
+    bool Stopping = false;
+
+    std::string Pending;
+    size_t PendingOps = 0;
+    std::chrono::steady_clock::time_point FirstPending;
+    // the last commit failed, so what is waiting has to be written again from Size
+    bool Failed = false;
+
+    std::atomic<uint64_t> Size = 0;
+    uint64_t CompactedSize = 0;
+};
@@ -1,31 +1,141 @@
+#include <cctype>
+#include <cstdlib>
 #include <iostream>
+#include <span>
 #include <string>
+#include <thread>
 #include "database.hpp"
 
+// a number of bytes, which can end in K, M or G
+static size_t parseSize(const char* text) {
+    char* end;
+    size_t size = std::strtoull(text, &end, 10);
+    switch (std::toupper(static_cast<unsigned char>(*end))) {
+        case 'G': size <<= 10; [[fallthrough]];
+        case 'M': size <<= 10; [[fallthrough]];
+        case 'K': size <<= 10;
+    }
+    return size;
+}
+
 int main(int argc, char *argv[]) {
-    Database users;
+    // by default the input file is validated using every core
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // a script of commands to run instead of reading them from the user
+    const char* script = nullptr;
+
+    // a Unix domain socket to serve clients on instead of reading commands from the user
+    const char* socketPath = nullptr;
+
+    // how many shards the users are split into. Only the server changes users from several threads, so by default
+    // it gets one shard per thread and everything else gets one. More shards make writers wait on each other less
+    // but make every LIST and SEARCH look in more of them
+    size_t shards = 0;
+
+    // every change is appended to this file and replayed on the next start
+    const char* journal = nullptr;
+    JournalOptions journalOptions;
+
+    // print the STATS table when the program exits
+    bool stats = false;
+
+    // With a memory limit the input files are sorted into a snapshot at output on disk instead of loaded, for inputs
+    // bigger than memory. See externalImport.cpp
+    size_t memLimit = 0;
+    const char* output = nullptr;
+
+    // options come before the input file
+    int arg = 1;
+    while (arg < argc && std::string(argv[arg]).starts_with("--")) {
+        std::string option = argv[arg];
+        if (option == "--threads" && arg + 1 < argc) {
+            threads = std::max(1ul, std::strtoul(argv[arg + 1], nullptr, 10));
+            arg += 2;
+        } else if (option == "--script" && arg + 1 < argc) {
+            script = argv[arg + 1];
+            arg += 2;
+        } else if (option == "--serve" && arg + 1 < argc) {
+            socketPath = argv[arg + 1];
+            arg += 2;
+        } else if (option == "--shards" && arg + 1 < argc) {
+            shards = std::max(1ul, std::strtoul(argv[arg + 1], nullptr, 10));
+            arg += 2;
+        } else if (option == "--stats") {
+            stats = true;
+            arg += 1;
+        } else if (option == "--journal" && arg + 1 < argc) {
+            journal = argv[arg + 1];
+            arg += 2;
+        } else if (option == "--group-commit-ops" && arg + 1 < argc) {
+            journalOptions.groupCommitOps = std::max(1ul, std::strtoul(argv[arg + 1], nullptr, 10));
+            arg += 2;
+        } else if (option == "--group-commit-ms" && arg + 1 < argc) {
+            journalOptions.groupCommitTime = std::chrono::milliseconds(std::strtoul(argv[arg + 1], nullptr, 10));
+            arg += 2;
+        } else if (option == "--compact-bytes" && arg + 1 < argc) {
+            journalOptions.compactBytes = std::strtoull(argv[arg + 1], nullptr, 10);
+            arg += 2;
+        } else if (option == "--mem-limit" && arg + 1 < argc) {
+            memLimit = parseSize(argv[arg + 1]);
+            arg += 2;
+        } else if (option == "--output" && arg + 1 < argc) {
+            output = argv[arg + 1];
+            arg += 2;
+        } else {
+            std::cout << "Unknown option " << option << std::endl;
+            return -1;
+        }
+    }
+
+    if (memLimit || output) {
+        // any number of input files can be merged into one snapshot, and then the program exits
+        if (!memLimit || !output || arg == argc) {
+            std::cout << "--mem-limit and --output both have to be given, along with at least one input file" << std::endl;
+            return -1;
+        }
+        Database users;
+        if (!users.importExternal(std::span(argv + arg, argv + argc), output, memLimit)) return -1;
+        if (stats) users.printStats();
+        return 0;
+    }
 
-    if (argc > 2) {
+    if (shards == 0) shards = socketPath ? threads : 1;
+    Database users(shards);
+
+    if (argc - arg > 1) {
         std::cout << "Invalid input" << std::endl;
     }
-    if (argc == 2) {
+    if (argc - arg == 1) {
         // if a filename is provided as input, parse names and phone numbers from it
-        std::ifstream file(argv[1]);
-
-        // check to see if the file opened properly
-        if(!file.is_open()) {
+        // if the file is valid initilize the database with the information
+        if(!users.loadFile(argv[arg], threads)) {
             std::cout << "The file provided was unable to opened" << std::endl;
             return -1;
         }
+    }
 
-        // if the file is valid initilize the database with the information
-        users.populateFromFile(file);
-        
-        file.close();
+    if (journal && !users.openJournal(journal, journalOptions)) {
+        std::cout << "The journal provided was unable to opened" << std::endl;
+        return -1;
     }
 
-    // while the user has not quit, continue reading in commands
-    while(users.getCommand()) {}
-    
+    if (socketPath) {
+        if (!users.serve(socketPath, threads)) {
+            std::cout << "The socket provided was unable to be set up" << std::endl;
+            return -1;
+        }
+    } else if (script) {
+        if (!users.runScript(script)) {
+            std::cout << "The script provided was unable to opened" << std::endl;
+            return -1;
+        }
+    } else {
+        // while the user has not quit, continue reading in commands
+        while(users.getCommand()) {}
+    }
+
+    if (stats) users.printStats();
+
     return 0;
-}
\ No newline at end of file
+}
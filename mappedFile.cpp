@@ -0,0 +1,39 @@
+#include "mappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::~MappedFile() {
+    if (Size) munmap(const_cast<char*>(Data), Size);
+}
+
+bool MappedFile::open(const char* path) {
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) < 0) {
+        close(fd);
+        return false;
+    }
+
+    // an empty file cannot be mapped but is still a valid file with no users in it
+    if (info.st_size == 0) {
+        close(fd);
+        return true;
+    }
+
+    void* data = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    // the file is read once from start to end so let the kernel read ahead aggressively
+    madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+    Data = static_cast<const char*>(data);
+    Size = info.st_size;
+    return true;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// A read only memory map of a whole file
+// The file is unmapped when this goes out of scope, so views into it must not outlive it
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile();
+
+    // returns false if the file could not be opened or mapped
+    bool open(const char* path);
+
+    std::string_view contents() const { return {Data, Size}; }
+
+private:
+    const char* Data = nullptr;
+    size_t Size = 0;
+};
+
+// Removes the first line from contents and returns it without the newline
+// Lines are split the same way std::getline would, including a last line with no newline
+inline std::string_view takeLine(std::string_view& contents) {
+    size_t end = contents.find('\n');
+    std::string_view line = contents.substr(0, end);
+    contents.remove_prefix(end == std::string_view::npos ? contents.size() : end + 1);
+    return line;
+}
@@ -0,0 +1,80 @@
+#include "nameIndex.hpp"
+
+#include <algorithm>
+
+NameIndex::Position NameIndex::lowerBound(std::string_view name, const StringPool& names) const {
+    auto less = [&names](StringPool::Handle handle, std::string_view name) { return names.get(handle) < name; };
+
+    // the first block whose last name is not less than name holds the answer, if any block does
+    auto block = std::partition_point(Blocks.begin(), Blocks.end(), [&](const auto& block) { return less(block->back(), name); });
+    if (block == Blocks.end()) return {Blocks.size(), 0};
+
+    auto index = std::lower_bound((*block)->begin(), (*block)->end(), name, less);
+    return {size_t(block - Blocks.begin()), size_t(index - (*block)->begin())};
+}
+
+void NameIndex::insert(StringPool::Handle name, const StringPool& names) {
+    // the first name starts the first block. Searching an empty block for where it goes would look past its end
+    if (Blocks.empty()) {
+        auto& block = Blocks.emplace_back().inPlace();
+        block.reserve(MaxBlock);
+        block.push_back(name);
+        Count++;
+        return;
+    }
+
+    // a name after every other one goes at the end of the last block
+    Position at = lowerBound(names.get(name), names);
+    if (at.block == Blocks.size()) at = {Blocks.size() - 1, Blocks.back()->size()};
+
+    auto& block = Blocks[at.block].mutate();
+    block.insert(block.begin() + at.index, name);
+    Count++;
+
+    // a full block is split in half so both halves have room to grow
+    if (block.size() == MaxBlock) {
+        Block upper;
+        upper.reserve(MaxBlock);
+        upper.assign(block.begin() + MaxBlock / 2, block.end());
+        block.resize(MaxBlock / 2);
+        Blocks.insert(Blocks.begin() + at.block + 1, Cow<Block>(std::move(upper)));
+    }
+}
+
+void NameIndex::build(std::vector<StringPool::Handle> handles, const StringPool& names) {
+    std::sort(handles.begin(), handles.end(), [&names](StringPool::Handle a, StringPool::Handle b) { return names.get(a) < names.get(b); });
+
+    // the blocks start half full so adding names does not split every block straight away
+    Blocks.clear();
+    for (size_t i = 0; i < handles.size(); i += MaxBlock / 2) {
+        auto& block = Blocks.emplace_back().inPlace();
+        block.reserve(MaxBlock);
+        block.assign(handles.begin() + i, handles.begin() + std::min(handles.size(), i + MaxBlock / 2));
+    }
+    Count = handles.size();
+}
+
+void NameIndex::erase(StringPool::Handle name, const StringPool& names) {
+    Position at = lowerBound(names.get(name), names);
+    if (at.block == Blocks.size() || (*Blocks[at.block])[at.index] != name) return;
+
+    auto& block = Blocks[at.block].mutate();
+    block.erase(block.begin() + at.index);
+    Count--;
+
+    // Small blocks are merged with the next one so lots of erases do not leave the index as a long list of tiny
+    // blocks, which would make walking it slower
+    if (block.empty()) {
+        Blocks.erase(Blocks.begin() + at.block);
+    } else if (block.size() < MaxBlock / 4 && at.block + 1 < Blocks.size() && block.size() + Blocks[at.block + 1]->size() <= MaxBlock / 2) {
+        const auto& next = *Blocks[at.block + 1];
+        block.insert(block.end(), next.begin(), next.end());
+        Blocks.erase(Blocks.begin() + at.block + 1);
+    }
+}
+
+size_t NameIndex::memoryUsage() const {
+    size_t bytes = Blocks.capacity() * sizeof(Blocks[0]);
+    for (const auto& block : Blocks) bytes += block->capacity() * sizeof(StringPool::Handle);
+    return bytes;
+}
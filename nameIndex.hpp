@@ -0,0 +1,101 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "cow.hpp"
+#include "stringPool.hpp"
+
+// Keeps the names in a StringPool sorted so they can be walked in order and searched by prefix
+//
+// The handles are kept in order in blocks of at most MaxBlock, like a B-tree with a single level of leaves.
+// Finding a name is a binary search over the blocks and then one inside a block, and adding or removing one
+// only moves the rest of its block. The names are compared as UTF-8 bytes, which sorts them the same as
+// comparing their code points would.
+//
+// The index only holds handles, so every call takes the pool they came from
+//
+// Copies share their blocks, and changing a block a copy still has copies that block first, so a snapshot of the
+// index only costs a pointer per block
+class NameIndex {
+public:
+    // the name must not be in the index already
+    void insert(StringPool::Handle name, const StringPool& names);
+    void erase(StringPool::Handle name, const StringPool& names);
+    void clear() { Blocks.clear(); Count = 0; }
+    // replaces the index with these names, which is a lot quicker than adding them one at a time
+    void build(std::vector<StringPool::Handle> handles, const StringPool& names);
+
+    // calls visit with the handle of every name that starts with prefix, in order, until visit returns false
+    // Finding the first one costs about log n and after that it is one step per name
+    template<typename Visit>
+    void forEachWithPrefix(std::string_view prefix, const StringPool& names, Visit&& visit) const {
+        for (Position at = lowerBound(prefix, names); at.block < Blocks.size(); at.index = 0, at.block++) {
+            const auto& block = *Blocks[at.block];
+            for (; at.index < block.size(); at.index++) {
+                if (!names.get(block[at.index]).starts_with(prefix)) return;
+                if (!visit(block[at.index])) return;
+            }
+        }
+    }
+
+    // A place in the index, for walking it one name at a time instead of with a callback
+    struct Position {
+        size_t block;
+        size_t index;
+    };
+    // the first name that is not less than name
+    Position lowerBound(std::string_view name, const StringPool& names) const;
+    bool atEnd(Position at) const { return at.block >= Blocks.size(); }
+    StringPool::Handle get(Position at) const { return (*Blocks[at.block])[at.index]; }
+    void advance(Position& at) const {
+        if (++at.index == Blocks[at.block]->size()) at = {at.block + 1, 0};
+    }
+    // moves steps names on, a whole block at a time where it can
+    void advance(Position& at, size_t steps) const {
+        while (steps && !atEnd(at)) {
+            size_t left = Blocks[at.block]->size() - at.index;
+            if (steps < left) {
+                at.index += steps;
+                return;
+            }
+            steps -= left;
+            at = {at.block + 1, 0};
+        }
+    }
+
+    // moves at past names for as long as keep returns true for them, a block at a time
+    template<typename Keep>
+    void advanceWhile(Position& at, Keep&& keep) const {
+        for (; at.block < Blocks.size(); at = {at.block + 1, 0}) {
+            const auto& block = *Blocks[at.block];
+            for (; at.index < block.size(); at.index++) {
+                if (!keep(block[at.index])) return;
+            }
+        }
+    }
+    // calls visit with the handle of every name from one place up to another, a block at a time
+    template<typename Visit>
+    void forEachBetween(Position from, Position to, Visit&& visit) const {
+        for (; from.block < to.block; from = {from.block + 1, 0}) {
+            const auto& block = *Blocks[from.block];
+            for (size_t i = from.index; i < block.size(); i++) visit(block[i]);
+        }
+        if (from.block < Blocks.size()) {
+            const auto& block = *Blocks[from.block];
+            for (size_t i = from.index; i < to.index; i++) visit(block[i]);
+        }
+    }
+
+    size_t size() const { return Count; }
+    size_t memoryUsage() const;
+
+private:
+    // 2KB of handles, so shifting part of a block is cheap and a block is split rarely
+    static constexpr size_t MaxBlock = 512;
+
+    using Block = std::vector<StringPool::Handle>;
+
+    std::vector<Cow<Block>> Blocks;
+    size_t Count = 0;
+};
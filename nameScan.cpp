@@ -0,0 +1,161 @@
+#include "nameScan.hpp"
+
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// The banned ranges, inclusive on both ends. These are the same ranges validateName always checked
+struct Range {
+    uint32_t first;
+    uint32_t last;
+};
+
+constexpr Range BannedRanges[] = {
+    {0, 31},            // C0 controls
+    {127, 160},         // DEL, C1 controls and the no-break space
+    {8287, 8297},       // medium mathematical space, word joiner, invisible operators and the bidi isolates
+    {8433, 8447},       // unassigned combining marks for symbols
+    {917504, 921600},   // tags and variation selectors supplement
+};
+
+constexpr size_t npos = std::u32string_view::npos;
+
+} // namespace
+
+size_t findBannedCharacterScalar(std::u32string_view name) {
+    for (size_t i = 0; i < name.size(); i++) {
+        char32_t c = name[i];
+        if (c < 32) return i;
+        if (c > 126 && c < 161) return i;
+        if (c > 8286 && c < 8298) return i;
+        if (c > 8432 && c < 8448) return i;
+        if (c > 917503 && c < 921601) return i;
+    }
+    return npos;
+}
+
+#if defined(__x86_64__)
+
+// SSE2 and AVX2 only compare signed integers. Flipping the top bit of both sides turns that into an unsigned compare,
+// and c - first < last - first + 1 as unsigned numbers is true exactly when c is in the range, so each range is
+// a subtract, an xor and a compare for every lane at once
+
+namespace {
+
+// a bit for every lane of c that is in one of the banned ranges
+inline int bannedLanesSSE2(__m128i c) {
+    const __m128i flip = _mm_set1_epi32(INT32_MIN);
+    __m128i banned = _mm_setzero_si128();
+    for (const auto& range : BannedRanges) {
+        __m128i offset = _mm_xor_si128(_mm_sub_epi32(c, _mm_set1_epi32(range.first)), flip);
+        __m128i size = _mm_set1_epi32((range.last - range.first + 1) ^ 0x80000000u);
+        banned = _mm_or_si128(banned, _mm_cmplt_epi32(offset, size));
+    }
+    return _mm_movemask_ps(_mm_castsi128_ps(banned));
+}
+
+} // namespace
+
+size_t findBannedCharacterSSE2(std::u32string_view name) {
+    if (name.size() < 4) return findBannedCharacterScalar(name);
+
+    size_t i = 0;
+    for (; i + 4 <= name.size(); i += 4) {
+        int mask = bannedLanesSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(name.data() + i)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+
+    // The last few code points are checked by loading the last 4 again. The lanes that overlap were already
+    // found to be fine, so the first bit still set is the first banned character
+    if (i < name.size()) {
+        i = name.size() - 4;
+        int mask = bannedLanesSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(name.data() + i)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return npos;
+}
+
+namespace {
+
+// a bit for every lane of c that is in one of the banned ranges
+__attribute__((target("avx2")))
+inline int bannedLanesAVX2(__m256i c) {
+    const __m256i flip = _mm256_set1_epi32(INT32_MIN);
+    __m256i banned = _mm256_setzero_si256();
+    for (const auto& range : BannedRanges) {
+        __m256i offset = _mm256_xor_si256(_mm256_sub_epi32(c, _mm256_set1_epi32(range.first)), flip);
+        __m256i size = _mm256_set1_epi32((range.last - range.first + 1) ^ 0x80000000u);
+        banned = _mm256_or_si256(banned, _mm256_cmpgt_epi32(size, offset));
+    }
+    return _mm256_movemask_ps(_mm256_castsi256_ps(banned));
+}
+
+} // namespace
+
+__attribute__((target("avx2")))
+size_t findBannedCharacterAVX2(std::u32string_view name) {
+    size_t i = 0;
+    for (; i + 8 <= name.size(); i += 8) {
+        int mask = bannedLanesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(name.data() + i)));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+
+    if (i == name.size()) return npos;
+
+    // The end of a name is checked the same way as in the SSE2 version by loading the last 8 code points again
+    if (name.size() >= 8) {
+        i = name.size() - 8;
+        int mask = bannedLanesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(name.data() + i)));
+        return mask ? i + __builtin_ctz(mask) : npos;
+    }
+
+    // A lot of names are shorter than 8 code points, so they are loaded with a mask instead of falling back to
+    // the scalar loop. Masked out lanes read as 0, which would count as a control character, so only the lanes
+    // that were loaded are kept
+    size_t left = name.size();
+    __m256i lanes = _mm256_cmpgt_epi32(_mm256_set1_epi32(left), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    __m256i c = _mm256_maskload_epi32(reinterpret_cast<const int*>(name.data()), lanes);
+    int mask = bannedLanesAVX2(c) & ((1 << left) - 1);
+    return mask ? __builtin_ctz(mask) : npos;
+}
+
+bool cpuHasAVX2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif
+
+namespace {
+
+struct Scanner {
+    size_t (*scan)(std::u32string_view);
+    const char* name;
+};
+
+// picked once the first time a name is checked
+const Scanner& scanner() {
+    static const Scanner best = [] {
+#if defined(__x86_64__)
+        if (cpuHasAVX2()) return Scanner{findBannedCharacterAVX2, "avx2"};
+        return Scanner{findBannedCharacterSSE2, "sse2"};
+#else
+        return Scanner{findBannedCharacterScalar, "scalar"};
+#endif
+    }();
+    return best;
+}
+
+} // namespace
+
+size_t findBannedCharacter(std::u32string_view name) {
+    return scanner().scan(name);
+}
+
+const char* bannedCharacterScanner() {
+    return scanner().name;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// Finds the first character that is not allowed in a name: control characters and the invisible
+// formatting characters listed in Validator::validateName
+//
+// The names are range checked several code points at a time with SSE2 or AVX2. Which version is used
+// is picked the first time a name is checked from what the CPU supports, so the same build runs everywhere
+
+// index of the first character that is not allowed, or std::u32string_view::npos if the name is fine
+size_t findBannedCharacter(std::u32string_view name);
+
+// Every version on its own so the benchmark can compare them
+// The scalar one is the loop validateName used to have
+size_t findBannedCharacterScalar(std::u32string_view name);
+#if defined(__x86_64__)
+size_t findBannedCharacterSSE2(std::u32string_view name);
+size_t findBannedCharacterAVX2(std::u32string_view name);
+bool cpuHasAVX2();
+#endif
+// the name of the version findBannedCharacter uses
+const char* bannedCharacterScanner();
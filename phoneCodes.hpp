@@ -0,0 +1,15 @@
+#pragma once
+
+#include <string_view>
+
+// The area codes and country codes accepted by parsePhoneNumber
+// The lookup tables in phoneNumber.cpp are built from these lists at compile time,
+// so adding a code only means adding it here
+
+// List of in-use us area codes from:
+// https://en.wikipedia.org/wiki/List_of_North_American_Numbering_Plan_area_codes
+constexpr int AreaCodes[] = {201,202,203,204,205,206,207,208,209,210,211,212,213,214,215,216,217,218,219,220,223,224,225,226,227,228,229,231,234,236,239,240,242,246,248,249,250,251,252,253,254,256,260,262,263,264,267,268,269,270,272,274,276,278,279,281,283,284,289,301,302,303,304,305,306,307,308,309,310,311,312,313,314,315,316,317,318,319,320,321,323,325,326,327,330,331,332,334,336,337,339,340,341,343,345,346,347,351,352,354,360,361,363,364,365,367,368,369,380,382,385,386,387,401,402,403,404,405,406,407,408,409,410,411,412,413,414,415,416,417,418,419,423,424,425,428,430,431,432,434,435,437,438,440,441,442,443,445,447,448,450,456,458,463,464,468,469,470,472,473,474,475,478,479,480,484,500,501,502,503,504,505,506,507,508,509,510,511,512,513,514,515,516,517,518,519,520,521,522,523,524,525,526,530,531,532,533,534,535,538,539,540,541,544,545,546,547,548,549,550,551,555,556,557,558,559,561,562,563,564,566,567,569,570,571,572,573,574,575,577,578,579,580,581,582,584,585,586,587,588,589,600,601,602,603,604,605,606,607,608,609,610,611,612,613,614,615,616,617,618,619,620,622,623,626,627,628,629,630,631,633,636,639,640,641,644,646,647,649,650,651,655,656,657,658,659,660,661,662,664,667,669,670,671,672,677,678,679,680,681,682,683,684,688,689,700,701,702,703,704,705,706,707,708,709,710,711,712,713,714,715,716,717,718,719,720,721,724,725,726,727,730,731,732,734,737,740,742,743,747,753,754,757,758,760,762,763,764,765,767,769,770,771,772,773,774,775,778,779,780,781,782,784,785,786,787,800,801,802,803,804,805,806,807,808,809,810,811,812,813,814,815,816,817,818,819,820,822,825,826,828,829,830,831,832,833,835,838,839,840,843,844,845,847,848,849,850,854,855,856,857,858,859,860,861,862,863,864,865,866,867,868,869,870,872,873,876,877,878,879,888,889,900,901,902,903,904,905,906,907,908,909,910,911,912,913,914,915,916,917,918,919,920,925,927,928,929,930,931,932,934,935,936,937,938,939,940,941,943,945,947,948,949,950,951,952,954,956,959,970,971,972,973,975,978,979,980,983,984,985,986,988,989};
+
+// Country calling codes. A number is accepted if it starts with any of these
+// Some are listed more than once, which does no harm
+constexpr std::string_view CountryCodes[] = {"001","297","93","244","1264","358","355","376","971","54","374","1684","1268","61","43","994","257","32","229","226","880","359","973","1242","387","590","375","501","1441","591","55","1246","673","975","267","236","1","61","41","56","86","225","237","243","242","682","57","269","238","506","53","5999","61","1345","357","420","49","253","1767","45","1809","1829","1849","213","593","20","291","212","34","372","251","358","679","500","33","298","691","241","44","995","44","233","350","224","590","220","245","240","30","1473","299","502","594","1671","592","852","504","385","509","36","62","44","91","246","353","98","964","354","972","39","1876","44","962","81","76","77","254","996","855","686","1869","82","383","965","856","961","231","218","1758","423","94","266","370","352","371","853","590","212","377","373","261","960","52","692","389","223","356","95","382","976","1670","258","222","1664","596","230","265","60","262","264","687","227","672","234","505","683","31","47","977","674","64","968","92","507","64","51","63","680","675","48","1787","1939","850","351","595","970","689","974","262","40","7","250","966","249","221","65","500","4779","677","232","503","378","252","508","381","211","239","597","421","386","46","268","1721","248","963","1649","235","228","66","992","690","993","670","676","1868","216","90","688","886","255","256","380","598","1","998","3906698","379","1784","58","1284","1340","84","678","681","685","967","27","260","263"};
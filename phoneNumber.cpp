@@ -0,0 +1,281 @@
+#include "phoneNumber.hpp"
+#include "phoneCodes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <utility>
+
+namespace {
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+bool isLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+char toLower(char c) { return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c; }
+
+// case insensitive check that the input continues with word at position i
+bool matchesAt(std::string_view input, size_t i, std::string_view word) {
+    if (input.size() - i < word.size()) return false;
+    for (size_t j = 0; j < word.size(); j++) {
+        if (toLower(input[i + j]) != word[j]) return false;
+    }
+    return true;
+}
+
+// Every area code gets one bit in a 1000 bit table so checking one is a single load
+constexpr auto AreaCodeTable = [] {
+    std::array<uint64_t, 16> table{};
+    for (int code : AreaCodes) table[code / 64] |= uint64_t(1) << (code % 64);
+    return table;
+}();
+
+// A digit trie over the country codes. Node 0 is the root and a next of 0 means there is no child
+struct CountryCodeNode {
+    uint16_t next[10];
+    bool terminal;
+};
+
+// builds the trie into Size nodes and also returns how many nodes were actually needed
+// It is built once with plenty of room to count the nodes and then again at the exact size
+template<size_t Size>
+constexpr std::pair<std::array<CountryCodeNode, Size>, size_t> buildCountryCodeTrie() {
+    std::array<CountryCodeNode, Size> nodes{};
+    size_t count = 1;
+    for (auto code : CountryCodes) {
+        size_t node = 0;
+        for (char c : code) {
+            if (!nodes[node].next[c - '0']) nodes[node].next[c - '0'] = count++;
+            node = nodes[node].next[c - '0'];
+        }
+        nodes[node].terminal = true;
+    }
+    return {nodes, count};
+}
+
+constexpr auto CountryCodeTrie = buildCountryCodeTrie<buildCountryCodeTrie<1024>().second>().first;
+
+bool isAreaCode(const char* digits) {
+    int code = (digits[0] - '0') * 100 + (digits[1] - '0') * 10 + (digits[2] - '0');
+    return AreaCodeTable[code / 64] >> (code % 64) & 1;
+}
+
+// walks the trie until it reaches the end of a country code and returns its length, or 0 if the digits do not start with one
+// Some codes like "1" and "1264" start the same way, and the shorter one is the one that counts
+size_t countryCodeLength(std::string_view digits) {
+    size_t node = 0;
+    for (size_t i = 0; i < digits.size(); i++) {
+        node = CountryCodeTrie[node].next[digits[i] - '0'];
+        if (!node) return 0;
+        if (CountryCodeTrie[node].terminal) return i + 1;
+    }
+    return 0;
+}
+
+uint64_t toInteger(const char* digits, size_t count) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < count; i++) value = value * 10 + (digits[i] - '0');
+    return value;
+}
+
+// writes value as exactly count digits, keeping any leading zeros
+void writeDigits(uint64_t value, size_t count, char* out) {
+    for (size_t i = count; i > 0; i--) {
+        out[i - 1] = '0' + value % 10;
+        value /= 10;
+    }
+}
+
+} // namespace
+
+PhoneNumber::PhoneNumber(uint32_t countryCode, uint64_t national, unsigned nationalLength, bool northAmerican, uint64_t extention, unsigned extentionLength)
+    : Number(uint64_t(countryCode) << 50 | national),
+      Extention(extention | uint64_t(nationalLength) << 50 | uint64_t(extentionLength) << 54 | uint64_t(northAmerican) << 58) {}
+
+size_t PhoneNumber::format(char (&out)[MaxPhoneNumberLength]) const {
+    size_t length;
+    if (northAmerican()) {
+        // "ddd ddd dddd"
+        char digits[10];
+        writeDigits(nationalNumber(), 10, digits);
+        std::copy(digits, digits + 3, out);
+        out[3] = ' ';
+        std::copy(digits + 3, digits + 6, out + 4);
+        out[7] = ' ';
+        std::copy(digits + 6, digits + 10, out + 8);
+        length = 12;
+    } else {
+        // "+" and then every digit with nothing between them
+        uint32_t code = countryCode();
+        size_t codeLength = code >= 1000 ? 4 : code >= 100 ? 3 : code >= 10 ? 2 : 1;
+        out[0] = '+';
+        writeDigits(code, codeLength, out + 1);
+        writeDigits(nationalNumber(), nationalLength(), out + 1 + codeLength);
+        length = 1 + codeLength + nationalLength();
+    }
+
+    if (hasExtention()) {
+        out[length++] = 'x';
+        writeDigits(extention(), extentionLength(), out + length);
+        length += extentionLength();
+    }
+    return length;
+}
+
+bool PhoneNumber::wellFormed() const {
+    // every number fits in as many digits as its length says
+    auto fits = [](uint64_t value, unsigned digits) {
+        uint64_t limit = 1;
+        for (unsigned i = 0; i < digits; i++) limit *= 10;
+        return value < limit;
+    };
+    if (Extention >> 59 || !fits(extention(), extentionLength()) || !fits(nationalNumber(), nationalLength())) return false;
+    if (northAmerican()) return countryCode() == 1 && nationalLength() == 10;
+    // at most 15 digits with the country code, which is 1 to 4 of them
+    uint32_t code = countryCode();
+    size_t codeLength = code >= 1000 ? 4 : code >= 100 ? 3 : code >= 10 ? 2 : 1;
+    return code != 0 && code < 10000 && codeLength + nationalLength() <= 15;
+}
+
+std::string PhoneNumber::toString() const {
+    char text[MaxPhoneNumberLength];
+    return std::string(text, format(text));
+}
+
+std::ostream& operator<<(std::ostream& out, const PhoneNumber& phoneNumber) {
+    char text[MaxPhoneNumberLength];
+    return out.write(text, phoneNumber.format(text));
+}
+
+RejectReason parsePhoneNumber(std::string_view input, PhoneNumber& number) {
+    // The number is read as groups of digits and "+" separated by any run of the punctuation that is allowed in a number
+    // Only the first 4 group lengths matter because a North American number is at most "+1 ddd ddd dddd"
+    // Anything longer than 15 digits is invalid no matter how it is written
+    char digits[15];
+    size_t digitCount = 0;
+    size_t groupLengths[4] = {};
+    size_t groupCount = 0;
+    bool inGroup = false;
+    bool firstIsPlus = false;
+    int plusCount = 0;
+    int dotCount = 0;
+    int parenCount = 0;
+    bool parenGroup = false;
+    bool commas = false;
+
+    // The extention is everything after the one "x", "ext", "ext." or "extention"
+    char extention[15];
+    size_t extentionLength = 0;
+    bool hasExtention = false;
+
+    size_t i = 0;
+    for (; i < input.size(); i++) {
+        char c = input[i];
+
+        if (isDigit(c) || c == '+') {
+            if (!inGroup) {
+                if (groupCount == 0) firstIsPlus = c == '+';
+                groupCount++;
+                inGroup = true;
+            }
+            if (groupCount <= 4) groupLengths[groupCount - 1]++;
+
+            if (c == '+') {
+                plusCount++;
+            } else {
+                if (digitCount == sizeof(digits)) return RejectReason::BadLength;
+                digits[digitCount++] = c;
+            }
+            continue;
+        }
+
+        inGroup = false;
+        switch (c) {
+            case ' ': case '-': break;
+            case ',': commas = true; break;
+            // Sometimes the country code is separated from the number by a "."
+            // If there is more than one "." the number is invalid
+            case '.': if (++dotCount > 1) return RejectReason::BadPunctuation; break;
+            // Parentheses are only allowed once around the area code as in "(ddd)"
+            case '(': if (++parenCount > 2) return RejectReason::BadPunctuation; break;
+            case ')':
+                if (++parenCount > 2) return RejectReason::BadPunctuation;
+                if (i >= 4 && input[i - 4] == '(' && isDigit(input[i - 3]) && isDigit(input[i - 2]) && isDigit(input[i - 1])) parenGroup = true;
+                break;
+            default:
+                // Letters can only be the start of an extention, which is the only "x" in the number
+                // Extentions can be written as "x", "ext", "ext." or "extention"
+                if (!isLetter(c)) return RejectReason::InvalidCharacter;
+                if (matchesAt(input, i, "extention")) i += 9;
+                else if (matchesAt(input, i, "ext.")) i += 4;
+                else if (matchesAt(input, i, "ext")) i += 3;
+                else if (toLower(c) == 'x') i += 1;
+                else return RejectReason::InvalidCharacter;
+                hasExtention = true;
+                break;
+        }
+        if (hasExtention) break;
+    }
+
+    if (hasExtention) {
+        // An extention must be one or no spaces followed by between 1 and 15 digits
+        // I could not find an offical limit of the length of an extention and even found some sources saying
+        // they used some really long ones for niche uses like masking the number
+        // I have chosen to only allow a max of 15 digits because it is long enough to use it as a mask for a max length phone number
+        if (i < input.size() && input[i] == ' ') i++;
+        for (; i < input.size(); i++) {
+            if (!isDigit(input[i]) || extentionLength == sizeof(extention)) return RejectReason::BadExtention;
+            extention[extentionLength++] = input[i];
+        }
+        if (extentionLength == 0) return RejectReason::BadExtention;
+    } else if (commas) {
+        // commas are only allowed alongside an extention
+        return RejectReason::BadPunctuation;
+    }
+
+    if (parenCount && !parenGroup) return RejectReason::BadPunctuation;
+
+    bool plusOne = firstIsPlus && groupCount > 1 && groupLengths[0] == 2 && digits[0] == '1';
+    // where the 10 digits of a North American number start, or nullptr for an international number
+    const char* northAmerican = nullptr;
+    uint32_t countryCode = 1;
+    size_t nationalStart = 0;
+
+    if (firstIsPlus && !plusOne) {
+        // International number. I decided to not create parsers based on spesfic country codes
+        // The max length of an international number is 15 digits and the shortest is 7
+        if (plusCount != 1) return RejectReason::BadFormat;
+        if (digitCount < 7) return RejectReason::BadLength;
+
+        std::string_view number(digits, digitCount);
+        size_t codeLength = countryCodeLength(number);
+        if (!codeLength) return RejectReason::BadCountryCode;
+
+        if (number.starts_with("001")) {
+            // North American number written with the international prefix
+            if (digitCount != 13) return RejectReason::BadLength;
+            northAmerican = digits + 3;
+        } else {
+            countryCode = toInteger(digits, codeLength);
+            nationalStart = codeLength;
+        }
+    } else {
+        // Parse as an North American number, optionally written with a leading "+1"
+        // It has to be in the form "ddd ddd dddd" with any punctuation between the groups
+        size_t first = plusOne ? 1 : 0;
+        if (plusCount != (plusOne ? 1 : 0) || groupCount != first + 3) return RejectReason::BadFormat;
+        if (groupLengths[first] != 3 || groupLengths[first + 1] != 3 || groupLengths[first + 2] != 4) return RejectReason::BadFormat;
+        northAmerican = digits + first;
+    }
+
+    if (northAmerican) {
+        // the area code has to be valid and in use
+        if (northAmerican[0] < '2' || !isAreaCode(northAmerican)) return RejectReason::BadAreaCode;
+        number = PhoneNumber(1, toInteger(northAmerican, 10), 10, true, toInteger(extention, extentionLength), extentionLength);
+    } else {
+        size_t nationalLength = digitCount - nationalStart;
+        number = PhoneNumber(countryCode, toInteger(digits + nationalStart, nationalLength), nationalLength, false,
+                             toInteger(extention, extentionLength), extentionLength);
+    }
+
+    return RejectReason::None;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "rejectReason.hpp"
+
+// The longest canonical phone number is "+" with 15 digits followed by "x" and a 15 digit extention
+constexpr size_t MaxPhoneNumberLength = 32;
+
+// A validated phone number packed into 16 bytes
+//
+// A North American number is country code 1 and its 10 digits, an international number is the country code
+// it starts with and the rest of its digits. The lengths are kept as well so leading zeros are not lost.
+// Comparing or hashing one is a couple of integer operations. The text form like "202 201 3252x10001"
+// is only made when it is printed
+class PhoneNumber {
+public:
+    PhoneNumber() = default;
+    PhoneNumber(uint32_t countryCode, uint64_t national, unsigned nationalLength, bool northAmerican, uint64_t extention = 0, unsigned extentionLength = 0);
+
+    uint32_t countryCode() const { return Number >> 50; }
+    uint64_t nationalNumber() const { return Number & Low50; }
+    unsigned nationalLength() const { return (Extention >> 50) & 15; }
+    // written as "ddd ddd dddd" rather than "+" and the digits
+    bool northAmerican() const { return Extention >> 58 & 1; }
+    bool hasExtention() const { return extentionLength() != 0; }
+    uint64_t extention() const { return Extention & Low50; }
+    unsigned extentionLength() const { return (Extention >> 54) & 15; }
+
+    // writes the canonical text form into out and returns its length
+    size_t format(char (&out)[MaxPhoneNumberLength]) const;
+    std::string toString() const;
+
+    // Whether the fields fit together the way they do in every number parsePhoneNumber packs. Checked on packed
+    // numbers read back from a file, so a damaged one can not make format write past the end of its buffer
+    bool wellFormed() const;
+
+    bool operator==(const PhoneNumber&) const = default;
+    size_t hash() const {
+        uint64_t h = Number * 0x9e3779b97f4a7c15 ^ Extention;
+        return h ^ (h >> 29);
+    }
+
+private:
+    static constexpr uint64_t Low50 = (uint64_t(1) << 50) - 1;
+
+    // country code in the top 14 bits and the national number in the low 50
+    uint64_t Number = 0;
+    // the extention in the low 50 bits, then the national number length, the extention length and the North American flag
+    uint64_t Extention = 0;
+};
+
+template<>
+struct std::hash<PhoneNumber> {
+    size_t operator()(const PhoneNumber& phoneNumber) const noexcept { return phoneNumber.hash(); }
+};
+
+std::ostream& operator<<(std::ostream& out, const PhoneNumber& phoneNumber);
+
+// Validates a phone number and packs it into number
+// Returns why the phone number is invalid, or RejectReason::None if it is valid
+// This is a single pass over the input and never allocates
+RejectReason parsePhoneNumber(std::string_view input, PhoneNumber& number);
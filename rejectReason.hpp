@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+
+// Why a name or phone number was rejected
+enum class RejectReason : uint8_t {
+    None,
+    // name
+    InvalidUTF8,
+    EmptyName,
+    ControlCharacter,
+    // phone number
+    InvalidCharacter,
+    BadExtention,
+    BadPunctuation,
+    BadLength,
+    BadFormat,
+    BadCountryCode,
+    BadAreaCode,
+};
+
+constexpr int RejectReasonCount = static_cast<int>(RejectReason::BadAreaCode) + 1;
+
+constexpr const char* describe(RejectReason reason) {
+    switch (reason) {
+        case RejectReason::None: return "valid";
+        case RejectReason::InvalidUTF8: return "name is not valid UTF-8";
+        case RejectReason::EmptyName: return "name is empty";
+        case RejectReason::ControlCharacter: return "name has a control or invisible character";
+        case RejectReason::InvalidCharacter: return "phone number has a character that can not be in a phone number";
+        case RejectReason::BadExtention: return "phone number has a badly formed extension";
+        case RejectReason::BadPunctuation: return "phone number has misplaced punctuation";
+        case RejectReason::BadLength: return "phone number has the wrong number of digits";
+        case RejectReason::BadFormat: return "phone number is not in a recognized format";
+        case RejectReason::BadCountryCode: return "phone number has an unknown country code";
+        case RejectReason::BadAreaCode: return "phone number has an unknown area code";
+    }
+    return "unknown";
+}
+
+// A short name for each reason that is easy to match on in machine readable output
+constexpr const char* code(RejectReason reason) {
+    switch (reason) {
+        case RejectReason::None: return "ok";
+        case RejectReason::InvalidUTF8: return "invalid-utf8";
+        case RejectReason::EmptyName: return "empty-name";
+        case RejectReason::ControlCharacter: return "control-character";
+        case RejectReason::InvalidCharacter: return "invalid-character";
+        case RejectReason::BadExtention: return "bad-extension";
+        case RejectReason::BadPunctuation: return "bad-punctuation";
+        case RejectReason::BadLength: return "bad-length";
+        case RejectReason::BadFormat: return "bad-format";
+        case RejectReason::BadCountryCode: return "bad-country-code";
+        case RejectReason::BadAreaCode: return "bad-area-code";
+    }
+    return "unknown";
+}
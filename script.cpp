@@ -0,0 +1,233 @@
+#include "database.hpp"
+
+// Runs commands from a file without any prompts
+// Every command is one line with its fields separated by tabs:
+//
+//   ADD<TAB>name<TAB>phone number
+//   DEL<TAB>NAME<TAB>name[<TAB>selection]
+//   DEL<TAB>PHONE<TAB>phone number[<TAB>selection]
+//   LIST[<TAB>SORTED][<TAB>offset<TAB>count]
+//   SEARCH<TAB>start of a name
+//   STATS
+//   SAVE<TAB>snapshot file
+//   LOAD<TAB>snapshot file
+//   EXIT
+//
+// Blank lines and lines starting with # are skipped
+// Each command writes exactly one status line, "OK" or "ERROR<TAB>reason", after any output of its own
+// LIST writes one "USER<TAB>name<TAB>phone number" line per user and then "OK<TAB>count"
+// With an offset and count it skips the first offset users and writes at most count, then "OK<TAB>shown<TAB>total"
+// LIST SORTED writes the same sorted by name, and SEARCH writes only the users whose normalized name starts with
+// the normalized prefix, also sorted by name. Users with the same name stay in the order they were added
+// STATS writes "STAT<TAB>import<TAB>records|added|duplicates<TAB>count" for the import counts,
+// "STAT<TAB>reject<TAB>reason<TAB>count" for every reason a name or phone number can be rejected and
+// "STAT<TAB>stage|command<TAB>name<TAB>count<TAB>mean<TAB>p50<TAB>p99<TAB>max" with the times in nanoseconds
+// for every import stage and command, then "OK"
+// When a DEL matches more than one user the selection picks one of them in the order LIST shows them, counting from 1.
+// Without a selection it fails with "ERROR<TAB>ambiguous<TAB>count"
+// A name with a character that is not allowed fails with "ERROR<TAB>control-character<TAB>position", counting from 1
+// in the normalized name
+// ADD, DEL and LOAD fail with "ERROR<TAB>not-logged" when the change was made but the journal could not be written.
+// It is tried again with the next group, but the change is lost if the program stops first
+//
+// Commands lock what they use in the ShardedUserStore, so the server can run them on several threads at once.
+// LIST and SAVE work from a snapshot of the users, so they only hold the locks while it is taken
+//
+// All output goes into one buffer that is written out at the end, so a long script does not make a system call per line.
+// Only a huge amount of output, like listing millions of users, is written out sooner
+
+namespace {
+
+// only written out early if a script produces a huge amount of output
+constexpr size_t MaxBufferedOutput = 64 << 20;
+
+// splits a line on tabs into at most fields.size() fields and returns how many there were
+size_t splitFields(std::string_view line, std::span<std::string_view> fields) {
+    size_t count = 0;
+    while (count < fields.size()) {
+        size_t tab = line.find('\t');
+        fields[count++] = line.substr(0, tab);
+        if (tab == std::string_view::npos) break;
+        line.remove_prefix(tab + 1);
+    }
+    return count;
+}
+
+} // namespace
+
+bool Database::runScript(const char* path) {
+    MappedFile script;
+    if (!script.open(path)) return false;
+
+    std::string out;
+    out.reserve(1 << 20);
+    CommandBuffers buffers;
+
+    std::string_view contents = script.contents();
+    while (!contents.empty()) {
+        if (!runCommand(takeLine(contents), out, buffers, &std::cout)) break;
+
+        if (out.size() > MaxBufferedOutput) {
+            std::cout.write(out.data(), out.size());
+            out.clear();
+        }
+    }
+
+    std::cout.write(out.data(), out.size());
+    std::cout.flush();
+
+    return true;
+}
+
+bool Database::runCommand(std::string_view line, std::string& out, CommandBuffers& buffers, std::ostream* spill) {
+    if (line.empty() || line[0] == '#') return true;
+
+    auto error = [&out](std::string_view reason) {
+        out += "ERROR\t";
+        out += reason;
+        out += '\n';
+    };
+
+    PhoneNumber phoneNumber;
+    char phoneText[MaxPhoneNumberLength];
+
+    auto writeUser = [&out, &phoneText, spill](const UserView& user) {
+        out += "USER\t";
+        out += user.name;
+        out += '\t';
+        out.append(phoneText, user.phoneNumber.format(phoneText));
+        out += '\n';
+        if (spill && out.size() > MaxBufferedOutput) {
+            spill->write(out.data(), out.size());
+            out.clear();
+        }
+        return true;
+    };
+
+    std::string_view fields[4];
+    size_t count = splitFields(line, fields);
+    std::string_view command = fields[0];
+
+    // timed until the end of the function, including when a command ends early
+    CommandTimer timer(Statistics);
+
+    if (command == "ADD" && count == 3) {
+        timer.setCommand(Command::Add);
+        size_t position;
+        RejectReason reason = checkName(fields[1], buffers.name, position);
+        if (reason == RejectReason::None) {
+            reason = checkPhoneNumber(fields[2], phoneNumber);
+        }
+        if (reason == RejectReason::ControlCharacter) {
+            error(std::string(code(reason)) + '\t' + std::to_string(position + 1));
+        } else if (reason != RejectReason::None) {
+            error(code(reason));
+        } else {
+            // only the shard with this name is locked, so users with other names can be added at the same time
+            encodeUTF8(buffers.name, buffers.nameUTF8);
+            auto lock = Users.lockName(buffers.nameUTF8);
+            Change change = insertUser(buffers.nameUTF8, phoneNumber);
+            if (change == Change::Made) out += "OK\n";
+            else if (change == Change::Refused) error("exists");
+            else error("not-logged");
+        }
+    } else if (command == "DEL" && (count == 3 || count == 4) && (fields[1] == "NAME" || fields[1] == "PHONE")) {
+        timer.setCommand(Command::Del);
+        RejectReason reason;
+        size_t position = 0;
+        std::vector<UserStore::const_iterator> matches;
+        // held until the user is erased. Users with one name are all in one shard, but a phone number can be in any
+        ShardedUserStore::NameLock nameLock;
+        ShardedUserStore::ExclusiveLocks locks;
+        if (fields[1] == "NAME") {
+            reason = checkName(fields[2], buffers.name, position);
+            if (reason == RejectReason::None) {
+                encodeUTF8(buffers.name, buffers.nameUTF8);
+                nameLock = Users.lockName(buffers.nameUTF8);
+                matches = Users.findByName(buffers.nameUTF8);
+            }
+        } else {
+            reason = checkPhoneNumber(fields[2], phoneNumber);
+            if (reason == RejectReason::None) {
+                locks = Users.lockAll();
+                matches = Users.findByPhoneNumber(phoneNumber);
+            }
+        }
+
+        size_t selection = count == 4 ? std::strtoul(std::string(fields[3]).c_str(), nullptr, 10) : 0;
+
+        if (reason == RejectReason::ControlCharacter) {
+            error(std::string(code(reason)) + '\t' + std::to_string(position + 1));
+        } else if (reason != RejectReason::None) {
+            error(code(reason));
+        } else if (matches.empty()) {
+            error("not-found");
+        } else if (matches.size() > 1 && count == 3) {
+            error("ambiguous\t" + std::to_string(matches.size()));
+        } else if (count == 4 && (selection < 1 || selection > matches.size())) {
+            error("invalid-selection");
+        } else {
+            if (eraseUser(matches[count == 4 ? selection - 1 : 0]) == Change::Made) out += "OK\n";
+            else error("not-logged");
+        }
+    } else if (command == "LIST") {
+        timer.setCommand(Command::List);
+        bool sorted = count > 1 && fields[1] == "SORTED";
+        size_t numbers = count - 1 - sorted;
+        size_t offset = 0;
+        size_t pageSize = SIZE_MAX;
+        if ((numbers != 0 && numbers != 2) || (numbers == 2 && !(parseNumber(fields[1 + sorted], offset) && parseNumber(fields[2 + sorted], pageSize)))) {
+            error("invalid-command");
+            return true;
+        }
+
+        // listed from a snapshot so ADD and DEL on other threads do not wait while the page is written
+        ShardedUserStore users = snapshotUsers(sorted);
+        size_t shown = 0;
+        users.forEachInPage(offset, pageSize, sorted, [&](const UserView& user) {
+            writeUser(user);
+            shown++;
+        });
+        if (numbers == 2) out += "OK\t" + std::to_string(shown) + '\t' + std::to_string(users.size()) + '\n';
+        else out += "OK\t" + std::to_string(users.size()) + '\n';
+    } else if (command == "SEARCH" && count == 2) {
+        timer.setCommand(Command::Search);
+        if (!Validator::normalizeName(fields[1], buffers.name)) {
+            error(code(RejectReason::InvalidUTF8));
+            return true;
+        }
+        encodeUTF8(buffers.name, buffers.nameUTF8);
+        auto locks = Users.lockAllShared();
+        size_t found = 0;
+        Users.forEachWithPrefix(buffers.nameUTF8, [&](const UserView& user) {
+            writeUser(user);
+            found++;
+            return true;
+        });
+        out += "OK\t" + std::to_string(found) + '\n';
+    } else if (command == "STATS" && count == 1) {
+        timer.setCommand(Command::Stats);
+        Statistics.writeLines(out);
+        out += "OK\n";
+    } else if (command == "SAVE" && count == 2) {
+        timer.setCommand(Command::Save);
+        if (saveSnapshot(std::string(fields[1]).c_str())) out += "OK\n";
+        else error("save-failed");
+    } else if (command == "LOAD" && count == 2) {
+        timer.setCommand(Command::Load);
+        auto locks = Users.lockAll();
+        Change change = loadSnapshot(std::string(fields[1]).c_str());
+        if (change == Change::Made) out += "OK\t" + std::to_string(Users.size()) + '\n';
+        else if (change == Change::Refused) error("load-failed");
+        else error("not-logged");
+    } else if (command == "EXIT" && count == 1) {
+        timer.setCommand(Command::Exit);
+        out += "OK\n";
+        return false;
+    } else {
+        error("invalid-command");
+    }
+
+    compactJournal();
+    return true;
+}
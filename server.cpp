@@ -0,0 +1,231 @@
+#include "database.hpp"
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+// Serves one database to many clients at once over a Unix domain socket
+//
+// A client sends the same commands a script has, one per line, and gets back exactly what the script would have
+// written. It can send as many commands as it wants without waiting for the answers, and they are answered in order.
+//
+// There is one event loop for each thread and each has its own epoll. The listening socket is in every one of them
+// with EPOLLEXCLUSIVE, so a new client only wakes one loop, and that loop looks after the client from then on.
+// The commands lock what they use themselves (see shardedUserStore.hpp), so ADD and DEL of different names run at
+// the same time, as do any number of LIST and SEARCH. LIST and SAVE only hold the locks while they take a snapshot,
+// so a long listing never holds up a change. The sorted names are built before the first client connects and kept
+// up to date from then on, so a search never has to build them while other threads are reading.
+//
+// SIGINT or SIGTERM stops every loop, closes the clients and removes the socket file.
+
+namespace {
+
+// a client that sends commands faster than it reads the answers is not read from until it catches up
+constexpr size_t MaxPendingOutput = 4 << 20;
+constexpr size_t ReadSize = 64 << 10;
+// a line this long without a newline is not a command, so the client is dropped
+constexpr size_t MaxLineLength = 64 << 10;
+constexpr int MaxEvents = 64;
+
+struct Connection {
+    int fd;
+    std::string input;
+    std::string output;
+    size_t sent = 0;
+    CommandBuffers buffers;
+    // the client closed its end or sent EXIT, so it is closed once its output is sent
+    bool finished = false;
+    // something went wrong with the socket and it is closed right away
+    bool broken = false;
+    uint32_t events = 0;
+};
+
+// epoll hands back a pointer for each socket, and these two stand for the ones that are not clients
+char ListenerTag;
+char StopTag;
+
+// Written to by the signal handler to stop every loop. It is never read, so once it is written every loop keeps seeing it
+int StopFd = -1;
+
+void requestStop(int) {
+    uint64_t one = 1;
+    ssize_t ignored = write(StopFd, &one, sizeof(one));
+    (void)ignored;
+}
+
+void flush(Connection& connection) {
+    while (connection.sent < connection.output.size()) {
+        ssize_t written = send(connection.fd, connection.output.data() + connection.sent, connection.output.size() - connection.sent, MSG_NOSIGNAL);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) connection.broken = true;
+            return;
+        }
+        connection.sent += written;
+    }
+    connection.output.clear();
+    connection.sent = 0;
+}
+
+void receive(Connection& connection) {
+    char buffer[ReadSize];
+    ssize_t received = read(connection.fd, buffer, sizeof(buffer));
+    if (received > 0) {
+        connection.input.append(buffer, received);
+    } else if (received == 0) {
+        connection.finished = true;
+    } else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        connection.broken = true;
+    }
+}
+
+} // namespace
+
+bool Database::serve(const char* path, unsigned threads) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (std::strlen(path) >= sizeof(address.sun_path)) return false;
+    std::strcpy(address.sun_path, path);
+
+    // a socket left behind by a server that did not shut down cleanly is replaced, but nothing else is
+    struct stat existing;
+    if (stat(path, &existing) == 0 && S_ISSOCK(existing.st_mode)) unlink(path);
+
+    int listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (listener < 0) return false;
+    if (bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0) {
+        close(listener);
+        return false;
+    }
+
+    // A handler rather than a signalfd, because the journal may already have a thread of its own that would get
+    // the signal, and a signal the shell started us ignoring never reaches a signalfd
+    StopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    struct sigaction stop{}, previousInterrupt, previousTerminate;
+    stop.sa_handler = requestStop;
+    sigemptyset(&stop.sa_mask);
+    sigaction(SIGINT, &stop, &previousInterrupt);
+    sigaction(SIGTERM, &stop, &previousTerminate);
+
+    Users.sortNames();
+
+    std::cout << "Serving on " << path << " with " << threads << " threads" << std::endl;
+
+    auto loop = [&] {
+        int epoll = epoll_create1(EPOLL_CLOEXEC);
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLEXCLUSIVE;
+        event.data.ptr = &ListenerTag;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, listener, &event);
+        event.events = EPOLLIN;
+        event.data.ptr = &StopTag;
+        epoll_ctl(epoll, EPOLL_CTL_ADD, StopFd, &event);
+
+        std::unordered_map<Connection*, std::unique_ptr<Connection>> connections;
+
+        auto closeConnection = [&](Connection* connection) {
+            epoll_ctl(epoll, EPOLL_CTL_DEL, connection->fd, nullptr);
+            close(connection->fd);
+            connections.erase(connection);
+        };
+
+        // runs every complete command the client has sent, as long as it is keeping up with the answers
+        auto runCommands = [&](Connection& connection) {
+            size_t start = 0;
+            while (!connection.broken && connection.output.size() - connection.sent < MaxPendingOutput) {
+                size_t end = connection.input.find('\n', start);
+                // the last line of a client that has closed its end does not need a newline, like in a script
+                if (end == std::string::npos && !(connection.finished && start < connection.input.size())) break;
+                if (end == std::string::npos) end = connection.input.size();
+                std::string_view line(connection.input.data() + start, end - start);
+                start = std::min(end + 1, connection.input.size());
+
+                if (!runCommand(line, connection.output, connection.buffers, nullptr)) {
+                    connection.finished = true;
+                    start = connection.input.size();
+                }
+            }
+            connection.input.erase(0, start);
+            if (connection.input.size() > MaxLineLength && connection.input.find('\n') == std::string::npos) connection.broken = true;
+        };
+
+        epoll_event events[MaxEvents];
+        bool stopping = false;
+        while (!stopping) {
+            int ready = epoll_wait(epoll, events, MaxEvents, -1);
+            if (ready < 0 && errno == EINTR) continue;
+            if (ready < 0) break;
+
+            for (int i = 0; i < ready; i++) {
+                void* tag = events[i].data.ptr;
+                if (tag == &StopTag) {
+                    stopping = true;
+                    continue;
+                }
+                if (tag == &ListenerTag) {
+                    int fd;
+                    while ((fd = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+                        auto connection = std::make_unique<Connection>();
+                        connection->fd = fd;
+                        connection->events = EPOLLIN;
+                        epoll_event added{};
+                        added.events = EPOLLIN;
+                        added.data.ptr = connection.get();
+                        epoll_ctl(epoll, EPOLL_CTL_ADD, fd, &added);
+                        connections.emplace(connection.get(), std::move(connection));
+                    }
+                    continue;
+                }
+
+                // Anything already answered goes out first to make room, then new commands are read, run and answered.
+                // The connection is only woken again for what it is waiting on: more commands, room to send, or both
+                Connection& connection = *static_cast<Connection*>(tag);
+                flush(connection);
+                if (!connection.finished && connection.output.size() - connection.sent < MaxPendingOutput) receive(connection);
+                runCommands(connection);
+                flush(connection);
+
+                bool pending = connection.sent < connection.output.size();
+                if (connection.broken || (connection.finished && !pending)) {
+                    closeConnection(&connection);
+                    continue;
+                }
+                uint32_t wanted = pending ? uint32_t(EPOLLOUT) : 0u;
+                if (!connection.finished && connection.output.size() - connection.sent < MaxPendingOutput) wanted |= EPOLLIN;
+                if (wanted != connection.events) {
+                    epoll_event changed{};
+                    changed.events = wanted;
+                    changed.data.ptr = &connection;
+                    epoll_ctl(epoll, EPOLL_CTL_MOD, connection.fd, &changed);
+                    connection.events = wanted;
+                }
+            }
+        }
+
+        while (!connections.empty()) closeConnection(connections.begin()->first);
+        close(epoll);
+    };
+
+    std::vector<std::thread> loops;
+    for (unsigned i = 0; i < threads; i++) loops.emplace_back(loop);
+    for (auto& thread : loops) thread.join();
+
+    close(listener);
+    unlink(path);
+    sigaction(SIGINT, &previousInterrupt, nullptr);
+    sigaction(SIGTERM, &previousTerminate, nullptr);
+    close(StopFd);
+
+    std::cout << "Stopped serving" << std::endl;
+    return true;
+}
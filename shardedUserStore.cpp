@@ -0,0 +1,170 @@
+#include "shardedUserStore.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+ShardedUserStore::ShardedUserStore(size_t shards) {
+    Shards.resize(std::bit_ceil(std::max<size_t>(shards, 1)));
+    for (auto& shard : Shards) shard = std::make_unique<Shard>();
+}
+
+ShardedUserStore::ShardedUserStore(ShardedUserStore&& other) noexcept
+    : Shards(std::move(other.Shards)), NextOrder(other.NextOrder.load()), KeepSorted(other.KeepSorted) {}
+
+size_t ShardedUserStore::shardOf(std::string_view name) const {
+    return Shards.size() == 1 ? 0 : std::hash<std::string_view>()(name) & (Shards.size() - 1);
+}
+
+ShardedUserStore::ExclusiveLocks ShardedUserStore::lockAll() const {
+    ExclusiveLocks locks;
+    locks.reserve(Shards.size());
+    for (const auto& shard : Shards) locks.emplace_back(shard->lock);
+    return locks;
+}
+
+ShardedUserStore::SharedLocks ShardedUserStore::lockAllShared() const {
+    SharedLocks locks;
+    locks.reserve(Shards.size());
+    for (const auto& shard : Shards) locks.emplace_back(shard->lock);
+    return locks;
+}
+
+bool ShardedUserStore::insert(std::string_view name, const PhoneNumber& phoneNumber) {
+    // the number is taken while the shard is locked, so the numbers in one shard always go up
+    return shard(name).users.insert(name, phoneNumber, NextOrder.fetch_add(1, std::memory_order_relaxed));
+}
+
+ShardedUserStore::NameHandle ShardedUserStore::internName(std::string_view name) {
+    size_t shard = shardOf(name);
+    return {uint32_t(shard), Shards[shard]->users.internName(name)};
+}
+
+bool ShardedUserStore::insert(NameHandle name, const PhoneNumber& phoneNumber) {
+    return Shards[name.shard]->users.insert(name.name, phoneNumber, NextOrder.fetch_add(1, std::memory_order_relaxed));
+}
+
+void ShardedUserStore::erase(const_iterator it) {
+    shard(it->name).users.erase(it);
+}
+
+bool ShardedUserStore::erase(std::string_view name, const PhoneNumber& phoneNumber) {
+    UserStore& users = shard(name).users;
+    auto it = users.find(name, phoneNumber);
+    if (it == users.end()) return false;
+    users.erase(it);
+    return true;
+}
+
+std::vector<ShardedUserStore::const_iterator> ShardedUserStore::findByPhoneNumber(const PhoneNumber& phoneNumber) const {
+    if (Shards.size() == 1) return Shards[0]->users.findByPhoneNumber(phoneNumber);
+
+    std::vector<const_iterator> matches;
+    for (const auto& shard : Shards) {
+        auto found = shard->users.findByPhoneNumber(phoneNumber);
+        matches.insert(matches.end(), found.begin(), found.end());
+    }
+    std::sort(matches.begin(), matches.end(), [](const const_iterator& a, const const_iterator& b) { return a.order() < b.order(); });
+    return matches;
+}
+
+void ShardedUserStore::clear() {
+    for (auto& shard : Shards) {
+        shard->users.clear();
+        if (KeepSorted) shard->users.sortNames();
+    }
+}
+
+void ShardedUserStore::reserve(size_t count) {
+    // names hash evenly, so each shard gets its share and a little more
+    size_t each = count / Shards.size() + (Shards.size() == 1 ? 0 : count / Shards.size() / 8);
+    for (auto& shard : Shards) shard->users.reserve(each);
+}
+
+void ShardedUserStore::replaceWith(ShardedUserStore&& other) {
+    for (size_t i = 0; i < Shards.size(); i++) {
+        Shards[i]->users = std::move(other.Shards[i]->users);
+        if (KeepSorted) Shards[i]->users.sortNames();
+    }
+    NextOrder = std::max(NextOrder.load(), other.NextOrder.load());
+}
+
+ShardedUserStore ShardedUserStore::snapshot() const {
+    ShardedUserStore copy(Shards.size());
+    for (size_t i = 0; i < Shards.size(); i++) copy.Shards[i]->users = Shards[i]->users.snapshot();
+    copy.NextOrder = NextOrder.load();
+    copy.KeepSorted = KeepSorted;
+    return copy;
+}
+
+void ShardedUserStore::sortNames() {
+    // already sorted is the usual case, and then it writes nothing so readers can call it at the same time
+    if (KeepSorted) return;
+    KeepSorted = true;
+    for (auto& shard : Shards) shard->users.sortNames();
+}
+
+std::vector<ShardedUserStore::Next> ShardedUserStore::firstUsers() const {
+    std::vector<Next> next;
+    next.reserve(Shards.size());
+    for (const auto& shard : Shards) {
+        if (!shard->users.empty()) next.push_back({&shard->users, shard->users.begin()});
+    }
+    return next;
+}
+
+void ShardedUserStore::skipUsers(std::vector<Next>& next, size_t& offset) {
+    // The numbers are handed out one at a time, so at most offset users have a number below the first user left's
+    // number plus offset. Every shard skips to that number with a binary search, and whatever is left of offset
+    // goes again, which takes about as many rounds as it takes to halve offset down to nothing
+    while (offset && !next.empty()) {
+        uint64_t first = std::min_element(next.begin(), next.end(), [](const Next& a, const Next& b) { return a.it.order() < b.it.order(); })->it.order();
+        for (auto& shard : next) offset -= shard.users->skipBefore(shard.it, first + offset);
+        std::erase_if(next, [](const Next& shard) { return shard.it == shard.users->end(); });
+    }
+}
+
+std::vector<UserStore::NameCursor> ShardedUserStore::nameCursors(std::string_view prefix) const {
+    std::vector<UserStore::NameCursor> names;
+    names.reserve(Shards.size());
+    for (const auto& shard : Shards) {
+        auto cursor = shard->users.names(prefix);
+        if (!cursor.done()) names.push_back(cursor);
+    }
+    return names;
+}
+
+void ShardedUserStore::skipNames(std::vector<UserStore::NameCursor>& names, size_t& offset) {
+    // Names do not have numbers, so instead every shard skips the names before one that is stride names further on
+    // in the shard with the first name. Each name is compared once rather than merged, and if that would skip too
+    // many users nothing is skipped and the stride is halved. It aims at about half of what is left, which usually fits
+    auto strideFor = [&] { return names.empty() ? 0 : offset / names.size() / 2; };
+    for (size_t stride = strideFor(); stride;) {
+        auto first = std::min_element(names.begin(), names.end(), [](const auto& a, const auto& b) { return a.name() < b.name(); });
+        if (auto stop = first->nameAhead(stride)) {
+            auto moved = names;
+            size_t skipped = 0;
+            for (auto& cursor : moved) skipped += cursor.skipBefore(*stop);
+            if (skipped <= offset) {
+                offset -= skipped;
+                std::erase_if(moved, [](const auto& cursor) { return cursor.done(); });
+                names = std::move(moved);
+                stride = strideFor();
+                continue;
+            }
+        }
+        stride /= 2;
+    }
+}
+
+size_t ShardedUserStore::size() const {
+    size_t total = 0;
+    for (const auto& shard : Shards) total += shard->users.size();
+    return total;
+}
+
+size_t ShardedUserStore::memoryUsage() const {
+    size_t bytes = 0;
+    for (const auto& shard : Shards) bytes += shard->users.memoryUsage();
+    return bytes;
+}
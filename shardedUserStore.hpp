@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+#include "userStore.hpp"
+
+// The users split into shards by a hash of their name, each shard a UserStore with its own lock, so users with
+// different names can be added and deleted on different threads at the same time
+//
+// Everything about one name is in one shard, so adding a user, the duplicate check and finding or deleting users
+// by name only ever touch that shard. Finding users by phone number and listing them look at every shard.
+// Every user gets a number from one counter when it is added, and listing in the order they were added merges the
+// shards by that number, so the order is exactly the same however many shards there are. LIST SORTED and SEARCH
+// merge the sorted names of the shards the same way. Skipping to a page far into a list does not merge every user
+// it skips, see skipUsers and skipNames. With one shard everything goes straight to it.
+//
+// The store does not lock anything itself. Code that uses it from several threads at once holds lockName while it
+// works with the users with one name, and lockAll or lockAllShared while it works with anything else.
+// Something that reads every user for a long time, like LIST and SAVE, takes a snapshot instead and lets go of the
+// locks straight away
+class ShardedUserStore {
+public:
+    using const_iterator = UserStore::const_iterator;
+    using NameLock = std::unique_lock<std::shared_mutex>;
+    using ExclusiveLocks = std::vector<std::unique_lock<std::shared_mutex>>;
+    using SharedLocks = std::vector<std::shared_lock<std::shared_mutex>>;
+
+    // the count is rounded up to a power of two
+    explicit ShardedUserStore(size_t shards = 1);
+    ShardedUserStore(ShardedUserStore&& other) noexcept;
+    ShardedUserStore(const ShardedUserStore&) = delete;
+    ShardedUserStore& operator=(const ShardedUserStore&) = delete;
+
+    size_t shardCount() const { return Shards.size(); }
+
+    // Locks the shard with every user with this name
+    NameLock lockName(std::string_view name) const { return NameLock(shard(name).lock); }
+    // Locks every shard, always in the same order so two threads doing it can not deadlock
+    ExclusiveLocks lockAll() const;
+    SharedLocks lockAllShared() const;
+
+    // the same as for UserStore, in the shard the name belongs to
+    bool insert(std::string_view name, const PhoneNumber& phoneNumber);
+    // The same as UserStore::internName, for adding a lot of users who share names without hashing each name again
+    // for every user. The handle says which shard the name is in as well
+    struct NameHandle {
+        uint32_t shard;
+        StringPool::Handle name;
+    };
+    NameHandle internName(std::string_view name);
+    bool insert(NameHandle name, const PhoneNumber& phoneNumber);
+    void erase(const_iterator it);
+    // erases the user if it is there and returns whether it was
+    bool erase(std::string_view name, const PhoneNumber& phoneNumber);
+    bool contains(std::string_view name, const PhoneNumber& phoneNumber) const { return shard(name).users.contains(name, phoneNumber); }
+    std::vector<const_iterator> findByName(std::string_view name) const { return shard(name).users.findByName(name); }
+    // from every shard, in the order they were added
+    std::vector<const_iterator> findByPhoneNumber(const PhoneNumber& phoneNumber) const;
+    void clear();
+    void reserve(size_t count);
+    // Takes every user from other, which has to have the same number of shards, but keeps this store's locks
+    void replaceWith(ShardedUserStore&& other);
+    // A copy of every shard as it is now, see UserStore::snapshot. Hold lockAllShared while taking it so every shard
+    // is copied at the same point. The copy has locks of its own that nothing else knows about, so it needs none
+    ShardedUserStore snapshot() const;
+
+    // Builds the sorted names of every shard now and keeps them built from then on, even through clear and replaceWith.
+    // Searching from several threads at once is only safe once they are built
+    void sortNames();
+
+    // Calls visit with every user in the order they were added until visit returns false
+    template<typename Visit>
+    void forEach(Visit&& visit) const {
+        if (Shards.size() == 1) {
+            for (const auto& user : Shards[0]->users) {
+                if (!visit(user)) return;
+            }
+            return;
+        }
+        forEachFrom(0, visit);
+    }
+
+    // the same as UserStore::forEachWithPrefix, visit returns false to stop
+    template<typename Visit>
+    void forEachWithPrefix(std::string_view prefix, Visit&& visit) const {
+        if (Shards.size() == 1) return Shards[0]->users.forEachWithPrefix(prefix, visit);
+        mergeNames(nameCursors(prefix), [&](const UserStore::NameCursor& name) { return name.forEachUser(visit); });
+    }
+    template<typename Visit>
+    void forEachSorted(Visit&& visit) const { forEachWithPrefix({}, visit); }
+
+    // the same as UserStore::forEachInPage
+    template<typename Visit>
+    void forEachInPage(size_t offset, size_t count, bool sorted, Visit&& visit) const {
+        if (Shards.size() == 1) return Shards[0]->users.forEachInPage(offset, count, sorted, visit);
+        if (count == 0) return;
+
+        auto page = [&](const UserView& user) {
+            if (offset) {
+                offset--;
+                return true;
+            }
+            visit(user);
+            return --count != 0;
+        };
+        if (!sorted) {
+            return forEachFrom(offset, [&](const UserView& user) {
+                visit(user);
+                return --count != 0;
+            });
+        }
+
+        auto names = nameCursors({});
+        skipNames(names, offset);
+        // a name with fewer users than are left to skip is skipped without looking at them
+        mergeNames(std::move(names), [&](const UserStore::NameCursor& name) {
+            if (offset >= name.count()) {
+                offset -= name.count();
+                return true;
+            }
+            return name.forEachUser(page);
+        });
+    }
+
+    size_t size() const;
+    bool empty() const { return size() == 0; }
+    size_t memoryUsage() const;
+
+private:
+    struct Shard {
+        UserStore users;
+        mutable std::shared_mutex lock;
+    };
+
+    // in unique_ptrs so the locks never move
+    std::vector<std::unique_ptr<Shard>> Shards;
+    // the number the next user added to any shard gets
+    std::atomic<uint64_t> NextOrder = 0;
+    bool KeepSorted = false;
+
+    Shard& shard(std::string_view name) const { return *Shards[shardOf(name)]; }
+    size_t shardOf(std::string_view name) const;
+
+    // where one shard is up to in the order the users were added
+    struct Next {
+        const UserStore* users;
+        const_iterator it;
+    };
+    // the first user of every shard that has any
+    std::vector<Next> firstUsers() const;
+    // Moves every shard past as many of the first users overall as it can without going past offset of them, and
+    // takes off offset how many it moved past
+    static void skipUsers(std::vector<Next>& next, size_t& offset);
+
+    // Skips offset users in the order they were added, then calls visit with the rest until it returns false.
+    // The shards are merged with a heap on their next user's number
+    template<typename Visit>
+    void forEachFrom(size_t offset, Visit&& visit) const {
+        std::vector<Next> next = firstUsers();
+        skipUsers(next, offset);
+        auto later = [](const Next& a, const Next& b) { return a.it.order() > b.it.order(); };
+        std::make_heap(next.begin(), next.end(), later);
+        while (!next.empty()) {
+            std::pop_heap(next.begin(), next.end(), later);
+            Next& first = next.back();
+            if (!visit(*first.it)) return;
+            if (++first.it == first.users->end()) {
+                next.pop_back();
+            } else {
+                std::push_heap(next.begin(), next.end(), later);
+            }
+        }
+    }
+
+    // a cursor on the first name that starts with prefix in every shard that has one
+    std::vector<UserStore::NameCursor> nameCursors(std::string_view prefix) const;
+    // the same as skipUsers, for names in order
+    static void skipNames(std::vector<UserStore::NameCursor>& names, size_t& offset);
+
+    // Calls visit with each of the cursors' names in order across every shard until visit returns false. A name is
+    // only ever in one shard so there is nothing to merge within a name
+    template<typename Visit>
+    static void mergeNames(std::vector<UserStore::NameCursor> names, Visit&& visit) {
+        auto later = [](const UserStore::NameCursor& a, const UserStore::NameCursor& b) { return a.name() > b.name(); };
+        std::make_heap(names.begin(), names.end(), later);
+        while (!names.empty()) {
+            std::pop_heap(names.begin(), names.end(), later);
+            UserStore::NameCursor& first = names.back();
+            if (!visit(first)) return;
+            first.next();
+            if (first.done()) {
+                names.pop_back();
+            } else {
+                std::push_heap(names.begin(), names.end(), later);
+            }
+        }
+    }
+};
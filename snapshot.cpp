@@ -0,0 +1,255 @@
+#include "snapshot.hpp"
+#include "utf8.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char Magic[8] = {'I', 'V', 'S', 'N', 'A', 'P', 0, 0};
+constexpr uint32_t Version = 3;
+// every name in full and the phone numbers as text
+constexpr uint32_t TextVersion = 2;
+// names were UTF-32 before the store kept them in UTF-8
+constexpr uint32_t Utf32Version = 1;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    // 0 before version 3
+    uint32_t nameCount;
+    uint64_t userCount;
+    uint64_t blobSize;
+    uint64_t checksum;
+};
+
+static_assert(sizeof(PhoneNumber) == 16 && std::is_trivially_copyable_v<PhoneNumber>, "phone numbers are saved as their 16 bytes");
+
+size_t paddedLength(size_t length) { return (length + 3) & ~size_t(3); }
+
+// Loads a version 1 or 2 snapshot, which is every name in full and the phone numbers as text
+// The phone numbers are parsed again, and if one does not parse the snapshot is not loaded
+bool loadTextSnapshot(std::string_view blob, const SnapshotHeader& header, ShardedUserStore& users) {
+    // the name length counts code points in a version 1 snapshot
+    size_t nameUnit = header.version == Utf32Version ? 4 : 1;
+
+    // The records are walked twice. The first pass checks that every length fits in the blob and every phone number
+    // parses, so a snapshot that is somehow still malformed adds nothing, and the second builds the users
+    auto forEachRecord = [&blob, nameUnit](auto&& visit) {
+        size_t offset = 0;
+        uint64_t count = 0;
+        PhoneNumber phone;
+        while (offset < blob.size()) {
+            uint32_t nameLength, phoneLength;
+            if (blob.size() - offset < 4) return uint64_t(-1);
+            std::memcpy(&nameLength, blob.data() + offset, 4);
+            offset += 4;
+            size_t nameBytes = paddedLength(size_t(nameLength) * nameUnit);
+            if (size_t(nameLength) * nameUnit > blob.size() || blob.size() - offset < nameBytes) return uint64_t(-1);
+            const char* name = blob.data() + offset;
+            offset += nameBytes;
+
+            if (blob.size() - offset < 4) return uint64_t(-1);
+            std::memcpy(&phoneLength, blob.data() + offset, 4);
+            offset += 4;
+            if (blob.size() - offset < paddedLength(phoneLength)) return uint64_t(-1);
+            std::string_view phoneNumber(blob.data() + offset, phoneLength);
+            offset += paddedLength(phoneLength);
+            if (parsePhoneNumber(phoneNumber, phone) != RejectReason::None) return uint64_t(-1);
+
+            visit(name, nameLength, phone);
+            count++;
+        }
+        return count;
+    };
+
+    if (forEachRecord([](const char*, uint32_t, const PhoneNumber&) {}) != header.userCount) return false;
+
+    users.reserve(users.size() + header.userCount);
+    std::u32string utf32;
+    std::string utf8;
+    forEachRecord([&](const char* name, uint32_t nameLength, const PhoneNumber& phone) {
+        if (nameUnit == 1) {
+            users.insert(std::string_view(name, nameLength), phone);
+        } else {
+            utf32.resize(nameLength);
+            std::memcpy(utf32.data(), name, size_t(nameLength) * 4);
+            encodeUTF8(utf32, utf8);
+            users.insert(utf8, phone);
+        }
+    });
+
+    return true;
+}
+
+} // namespace
+
+bool saveSnapshot(const ShardedUserStore& users, const char* path) {
+    SnapshotWriter writer;
+    if (!writer.open(path)) return false;
+
+    // the names are views into the store's pools, so they stay valid for the writer to remember
+    users.forEach([&](const UserView& user) {
+        writer.add(user.name, user.phoneNumber);
+        return true;
+    });
+
+    return writer.finish();
+}
+
+SnapshotWriter::~SnapshotWriter() {
+    if (!File) return;
+    std::fclose(File);
+    std::remove(Temporary.c_str());
+}
+
+bool SnapshotWriter::open(const char* path, bool sortedNames) {
+    Path = path;
+    Temporary = Path + ".tmp";
+    SortedNames = sortedNames;
+    File = std::fopen(Temporary.c_str(), "wb");
+    if (!File) return false;
+
+    // a big buffer so the records are written in large chunks
+    Buffer.resize(1 << 20);
+    std::setvbuf(File, Buffer.data(), _IOFBF, Buffer.size());
+
+    // the header is written again once the counts and checksum are known
+    SnapshotHeader header{};
+    Ok = std::fwrite(&header, sizeof(header), 1, File) == 1;
+    return true;
+}
+
+void SnapshotWriter::add(std::string_view name, const PhoneNumber& phoneNumber) {
+    // a name that was written before is only its number, otherwise it gets the next number and is written in full
+    uint32_t number = NameCount;
+    if (SortedNames) {
+        if (NameCount && name == LastName) number = NameCount - 1;
+        else LastName = name;
+    } else {
+        number = Names.try_emplace(name, NameCount).first->second;
+    }
+    bool newName = number == NameCount;
+    if (newName) NameCount++;
+
+    // one record at a time: the name number, the padded name if it is new and the packed phone number
+    size_t size = 4 + (newName ? 4 + paddedLength(name.size()) : 0) + sizeof(PhoneNumber);
+    Record.assign(size, 0);
+
+    char* out = Record.data();
+    std::memcpy(out, &number, 4);
+    out += 4;
+    if (newName) {
+        uint32_t nameLength = name.size();
+        std::memcpy(out, &nameLength, 4);
+        std::memcpy(out + 4, name.data(), nameLength);
+        out += 4 + paddedLength(nameLength);
+    }
+    std::memcpy(out, &phoneNumber, sizeof(PhoneNumber));
+
+    Sum.add(Record.data(), size);
+    BlobSize += size;
+    UserCount++;
+    Ok = Ok && std::fwrite(Record.data(), size, 1, File) == 1;
+}
+
+bool SnapshotWriter::finish() {
+    SnapshotHeader header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.nameCount = NameCount;
+    header.userCount = UserCount;
+    header.blobSize = BlobSize;
+    header.checksum = Sum.value();
+    bool ok = Ok && std::fseek(File, 0, SEEK_SET) == 0 && std::fwrite(&header, sizeof(header), 1, File) == 1;
+    ok = (std::fclose(File) == 0) && ok;
+    File = nullptr;
+
+    if (!ok || std::rename(Temporary.c_str(), Path.c_str()) != 0) {
+        std::remove(Temporary.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool isSnapshot(std::string_view contents) {
+    return contents.size() >= sizeof(SnapshotHeader) && std::memcmp(contents.data(), Magic, sizeof(Magic)) == 0;
+}
+
+bool loadSnapshot(std::string_view contents, ShardedUserStore& users) {
+    if (!isSnapshot(contents)) return false;
+
+    SnapshotHeader header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+    if (header.version != Version && header.version != TextVersion && header.version != Utf32Version) return false;
+
+    std::string_view blob = contents.substr(sizeof(header));
+    if (blob.size() != header.blobSize) return false;
+
+    Checksum checksum;
+    checksum.add(blob.data(), blob.size());
+    if (checksum.value() != header.checksum) return false;
+
+    if (header.version != Version) return loadTextSnapshot(blob, header, users);
+
+    // The records are walked twice. The first pass checks that every length fits in the blob, that every name number
+    // is one that has been seen and that every phone number is one parsePhoneNumber could have packed, so a snapshot
+    // that is somehow still malformed adds nothing. The second builds the users. Nothing is validated or parsed again
+    // since only validated users are ever saved, and each name is interned once however many users have it
+    auto forEachRecord = [&blob](auto&& visit) {
+        size_t offset = 0;
+        uint64_t count = 0;
+        uint32_t names = 0;
+        while (offset < blob.size()) {
+            uint32_t number;
+            if (blob.size() - offset < 4) return uint64_t(-1);
+            std::memcpy(&number, blob.data() + offset, 4);
+            offset += 4;
+            if (number > names) return uint64_t(-1);
+
+            std::string_view name;
+            if (number == names) {
+                uint32_t nameLength;
+                if (blob.size() - offset < 4) return uint64_t(-1);
+                std::memcpy(&nameLength, blob.data() + offset, 4);
+                offset += 4;
+                if (nameLength > blob.size() || blob.size() - offset < paddedLength(nameLength)) return uint64_t(-1);
+                name = std::string_view(blob.data() + offset, nameLength);
+                offset += paddedLength(nameLength);
+                names++;
+            }
+
+            PhoneNumber phone;
+            if (blob.size() - offset < sizeof(PhoneNumber)) return uint64_t(-1);
+            std::memcpy(&phone, blob.data() + offset, sizeof(PhoneNumber));
+            offset += sizeof(PhoneNumber);
+
+            if (!visit(number, name, phone)) return uint64_t(-1);
+            count++;
+        }
+        return count;
+    };
+
+    uint32_t names = 0;
+    auto check = [&names](uint32_t number, std::string_view, const PhoneNumber& phone) {
+        names += number == names;
+        return phone.wellFormed();
+    };
+    if (forEachRecord(check) != header.userCount || names != header.nameCount) return false;
+
+    users.reserve(users.size() + header.userCount);
+    std::vector<ShardedUserStore::NameHandle> handles;
+    handles.reserve(header.nameCount);
+    forEachRecord([&](uint32_t number, std::string_view name, const PhoneNumber& phone) {
+        if (number == handles.size()) handles.push_back(users.internName(name));
+        users.insert(handles[number], phone);
+        return true;
+    });
+
+    return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "checksum.hpp"
+#include "shardedUserStore.hpp"
+
+// A binary copy of every user that has already been validated, so a database can be brought back
+// without normalizing and validating every name and phone number again
+//
+// The file is a fixed header followed by one blob with every user back to back in LIST order.
+// Names are numbered in the order they first appear. Each user is a 32 bit name number, and if that is the next
+// number, so a name that has not appeared yet, it is followed by a 32 bit name length and the name in UTF-8 padded
+// with zeros to a multiple of 4 bytes. Then comes the phone number as the 16 bytes of its PhoneNumber, so loading
+// interns each name once and never parses a phone number. Version 2 snapshots stored every name in full and the
+// phone numbers as text, and version 1 stored the names in UTF-32. Both can still be loaded, parsing the phone numbers
+// again. Numbers are stored in the byte order of the machine that saved it, and PhoneNumber is packed the same way
+// on every machine this builds on, since it is two 64 bit integers.
+// The header has a version number and a checksum of the blob, and a snapshot with the wrong version or checksum is not loaded
+
+// Writes every user to path. The snapshot is written to a temporary file first and renamed over path,
+// so a failed save never leaves a half written snapshot behind. Returns false if it could not be written
+bool saveSnapshot(const ShardedUserStore& users, const char* path);
+
+// Writes a snapshot one user at a time, for users that are not all in a ShardedUserStore at once
+// Like saveSnapshot it writes to a temporary file that is only renamed over path by finish(). The temporary
+// file is removed if this goes out of scope before then
+class SnapshotWriter {
+public:
+    SnapshotWriter() = default;
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+    ~SnapshotWriter();
+
+    // Returns false if the temporary file could not be created
+    // A name that was written before is written as its number. To know that, every name passed to add is remembered,
+    // so the views have to stay valid until finish. With sortedNames, for users that come sorted by name, a name is
+    // only compared with the one before and nothing has to stay valid
+    bool open(const char* path, bool sortedNames = false);
+    // the name is already normalized UTF-8
+    void add(std::string_view name, const PhoneNumber& phoneNumber);
+    // Writes the header and renames the file over path. Returns false if anything could not be written
+    bool finish();
+
+    uint64_t count() const { return UserCount; }
+
+private:
+    std::FILE* File = nullptr;
+    std::string Path;
+    std::string Temporary;
+    std::vector<char> Buffer;
+    std::vector<char> Record;
+    bool SortedNames = false;
+    std::unordered_map<std::string_view, uint32_t> Names;
+    std::string LastName;
+    uint32_t NameCount = 0;
+    uint64_t UserCount = 0;
+    uint64_t BlobSize = 0;
+    Checksum Sum;
+    bool Ok = false;
+};
+
+// Checks whether a file starts like a snapshot rather than a text file of users
+bool isSnapshot(std::string_view contents);
+
+// Adds every user in the snapshot to users. Returns false and adds nothing if it is not a valid snapshot
+bool loadSnapshot(std::string_view contents, ShardedUserStore& users);
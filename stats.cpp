@@ -0,0 +1,94 @@
+#include "stats.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+
+namespace {
+
+constexpr const char* StageNames[ImportStageCount] = {"read", "normalize", "validate-name", "validate-phone", "insert", "validate-batch"};
+constexpr const char* CommandNames[CommandCount] = {"ADD", "DEL", "LIST", "SEARCH", "SAVE", "LOAD", "STATS", "EXIT", "invalid"};
+
+// appends printf style text, which keeps the columns lined up without a stream
+template<typename... Args>
+void append(std::string& out, const char* format, Args... args) {
+    char line[256];
+    int length = std::snprintf(line, sizeof(line), format, args...);
+    out.append(line, std::min<size_t>(length, sizeof(line) - 1));
+}
+
+void writeRow(std::string& out, const char* name, const Histogram& histogram) {
+    append(out, "  %-16s %10llu %10llu %10llu %10llu %10llu\n", name, (unsigned long long)histogram.count(), (unsigned long long)histogram.mean(),
+        (unsigned long long)histogram.percentile(0.5), (unsigned long long)histogram.percentile(0.99), (unsigned long long)histogram.max());
+}
+
+void writeLine(std::string& out, const char* kind, const char* name, const Histogram& histogram) {
+    append(out, "STAT\t%s\t%s\t%llu\t%llu\t%llu\t%llu\t%llu\n", kind, name, (unsigned long long)histogram.count(), (unsigned long long)histogram.mean(),
+        (unsigned long long)histogram.percentile(0.5), (unsigned long long)histogram.percentile(0.99), (unsigned long long)histogram.max());
+}
+
+} // namespace
+
+void Histogram::record(uint64_t nanoseconds) {
+    Buckets[std::bit_width(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    Count.fetch_add(1, std::memory_order_relaxed);
+    Total.fetch_add(nanoseconds, std::memory_order_relaxed);
+    uint64_t max = Max.load(std::memory_order_relaxed);
+    while (nanoseconds > max && !Max.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) {}
+}
+
+uint64_t Histogram::percentile(double fraction) const {
+    if (count() == 0) return 0;
+
+    // the first bucket that gets the running count to the fraction, reported as the largest value it can hold
+    uint64_t total = count();
+    uint64_t wanted = fraction * total;
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < Buckets.size(); bucket++) {
+        seen += Buckets[bucket].load(std::memory_order_relaxed);
+        if (seen > wanted || seen >= total) {
+            uint64_t top = bucket == 64 ? UINT64_MAX : (uint64_t(1) << bucket) - 1;
+            return std::min(top, max());
+        }
+    }
+    return max();
+}
+
+void Stats::write(std::string& out) const {
+    uint64_t rejected = 0;
+    for (int reason = 1; reason < RejectReasonCount; reason++) rejected += Rejections[reason];
+
+    append(out, "Import\n");
+    append(out, "  %-16s %10llu\n", "records read", (unsigned long long)Records);
+    append(out, "  %-16s %10llu\n", "added", (unsigned long long)Accepted);
+    append(out, "  %-16s %10llu\n", "duplicates", (unsigned long long)Duplicates);
+
+    // rejections from imports and from commands alike
+    append(out, "\nRejected names and phone numbers: %llu\n", (unsigned long long)rejected);
+    for (int reason = 1; reason < RejectReasonCount; reason++) {
+        if (Rejections[reason]) append(out, "  %-66s %10llu\n", describe(static_cast<RejectReason>(reason)), (unsigned long long)Rejections[reason]);
+    }
+
+    append(out, "\nImport stages in ns, every %llu records\n", (unsigned long long)SampleEvery);
+    append(out, "  %-16s %10s %10s %10s %10s %10s\n", "stage", "count", "mean", "p50", "p99", "max");
+    for (int stage = 0; stage < ImportStageCount; stage++) {
+        if (Stages[stage].count()) writeRow(out, StageNames[stage], Stages[stage]);
+    }
+
+    append(out, "\nCommands in ns\n");
+    append(out, "  %-16s %10s %10s %10s %10s %10s\n", "command", "count", "mean", "p50", "p99", "max");
+    for (int command = 0; command < CommandCount; command++) {
+        if (Commands[command].count()) writeRow(out, CommandNames[command], Commands[command]);
+    }
+}
+
+void Stats::writeLines(std::string& out) const {
+    append(out, "STAT\timport\trecords\t%llu\n", (unsigned long long)Records);
+    append(out, "STAT\timport\tadded\t%llu\n", (unsigned long long)Accepted);
+    append(out, "STAT\timport\tduplicates\t%llu\n", (unsigned long long)Duplicates);
+    for (int reason = 1; reason < RejectReasonCount; reason++) {
+        append(out, "STAT\treject\t%s\t%llu\n", code(static_cast<RejectReason>(reason)), (unsigned long long)Rejections[reason]);
+    }
+    for (int stage = 0; stage < ImportStageCount; stage++) writeLine(out, "stage", StageNames[stage], Stages[stage]);
+    for (int command = 0; command < CommandCount; command++) writeLine(out, "command", CommandNames[command], Commands[command]);
+}
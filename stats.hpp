@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "rejectReason.hpp"
+
+// Counters and latency histograms for the import and the commands, shown by the STATS command
+//
+// Counting is always exact. Timing every stage of every imported record would read the clock five times per
+// record, which costs about as much as validating it, so only every SampleEvery-th record is timed
+
+// Latencies in power of two buckets of nanoseconds, so recording one is a few instructions
+// and the percentiles are never off by more than a factor of two
+// The counts are atomic because the server times commands that run on several threads at once
+class Histogram {
+public:
+    void record(uint64_t nanoseconds);
+
+    uint64_t count() const { return Count.load(std::memory_order_relaxed); }
+    uint64_t mean() const { return count() ? Total.load(std::memory_order_relaxed) / count() : 0; }
+    uint64_t max() const { return Max.load(std::memory_order_relaxed); }
+    // the latency that fraction of the samples were at or under, rounded up to the end of its bucket
+    uint64_t percentile(double fraction) const;
+
+private:
+    // bucket b holds the samples that take b bits, so 0, 1, 2-3, 4-7 and so on
+    std::array<std::atomic<uint64_t>, 65> Buckets{};
+    std::atomic<uint64_t> Count = 0;
+    std::atomic<uint64_t> Total = 0;
+    std::atomic<uint64_t> Max = 0;
+};
+
+enum class ImportStage : uint8_t {
+    Read,
+    Normalize,
+    ValidateName,
+    ValidatePhoneNumber,
+    Insert,
+    // a whole batch on one of the worker threads of a parallel import
+    ValidateBatch,
+};
+constexpr int ImportStageCount = static_cast<int>(ImportStage::ValidateBatch) + 1;
+
+enum class Command : uint8_t {
+    Add,
+    Del,
+    List,
+    Search,
+    Save,
+    Load,
+    Stats,
+    Exit,
+    Invalid,
+};
+constexpr int CommandCount = static_cast<int>(Command::Invalid) + 1;
+
+class Stats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint64_t SampleEvery = 16;
+
+    // whether the stages of the next record read from an import file should be timed
+    bool timeNextRecord() const { return Records % SampleEvery == 0; }
+    void countRecord() { Records++; }
+    void countAccepted() { Accepted++; }
+    void countDuplicate() { Duplicates++; }
+    void countRejection(RejectReason reason) { Rejections[static_cast<int>(reason)].fetch_add(1, std::memory_order_relaxed); }
+
+    void time(ImportStage stage, Clock::duration elapsed) { Stages[static_cast<int>(stage)].record(nanoseconds(elapsed)); }
+    void time(Command command, Clock::duration elapsed) { Commands[static_cast<int>(command)].record(nanoseconds(elapsed)); }
+
+    // a table for people to read
+    void write(std::string& out) const;
+    // "STAT<TAB>..." lines for scripts, described in script.cpp
+    void writeLines(std::string& out) const;
+
+private:
+    uint64_t Records = 0;
+    uint64_t Accepted = 0;
+    uint64_t Duplicates = 0;
+    // ADD and DEL count rejections from several threads at once in the server, but only an import counts the others
+    std::array<std::atomic<uint64_t>, RejectReasonCount> Rejections{};
+    std::array<Histogram, ImportStageCount> Stages;
+    std::array<Histogram, CommandCount> Commands;
+
+    static uint64_t nanoseconds(Clock::duration elapsed) { return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(); }
+};
+
+// Times the stages of one record one after another. A timer that is not enabled never reads the clock
+class StageTimer {
+public:
+    StageTimer(Stats& stats, bool enabled) : Statistics(stats), Enabled(enabled) {
+        if (Enabled) Last = Stats::Clock::now();
+    }
+
+    // records the time since the last stage ended as the time of this stage
+    void lap(ImportStage stage) {
+        if (!Enabled) return;
+        auto now = Stats::Clock::now();
+        Statistics.time(stage, now - Last);
+        Last = now;
+    }
+
+private:
+    Stats& Statistics;
+    bool Enabled;
+    Stats::Clock::time_point Last;
+};
+
+// Times one command from when it is made until it goes out of scope, as whichever command it was last told it is
+class CommandTimer {
+public:
+    explicit CommandTimer(Stats& stats) : Statistics(stats), Start(Stats::Clock::now()) {}
+    ~CommandTimer() { Statistics.time(Kind, Stats::Clock::now() - Start); }
+
+    void setCommand(Command command) { Kind = command; }
+
+private:
+    Stats& Statistics;
+    Command Kind = Command::Invalid;
+    Stats::Clock::time_point Start;
+};
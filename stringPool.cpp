@@ -0,0 +1,98 @@
+#include "stringPool.hpp"
+
+#include <cstring>
+#include <functional>
+
+uint32_t StringPool::hash(std::string_view str) {
+    return static_cast<uint32_t>(std::hash<std::string_view>{}(str));
+}
+
+// the slot holding an equal string, or the empty slot where it would go
+size_t StringPool::slot(std::string_view str, uint32_t hash) const {
+    size_t mask = Table.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        Handle handle = Table[i];
+        if (handle == None) return i;
+        // the stored hash rules out almost every other string without touching its characters
+        const Entry& entry = Strings[handle];
+        if (entry.hash == hash && std::string_view(entry.data, entry.length) == str) return i;
+    }
+}
+
+StringPool::Handle StringPool::find(std::string_view str) const {
+    if (Table.empty()) return None;
+    return Table[slot(str, hash(str))];
+}
+
+StringPool::Handle StringPool::intern(std::string_view str) {
+    if ((Strings.size() + 1) * 2 > Table.size()) rehash(Table.empty() ? 64 : Table.size() * 2);
+
+    uint32_t h = hash(str);
+    size_t i = slot(str, h);
+    if (Table[i] != None) return Table[i];
+
+    Handle handle = Strings.size();
+    Strings.push_back({copy(str), static_cast<uint32_t>(str.size()), h});
+    Table[i] = handle;
+    return handle;
+}
+
+const char* StringPool::copy(std::string_view str) {
+    if (str.size() > Remaining) {
+        // a string too big for a block gets a block of its own so the current block is not wasted
+        if (str.size() > BlockSize / 4) {
+            Blocks.push_back(std::make_shared<char[]>(str.size()));
+            BlockBytes += str.size();
+            std::memcpy(Blocks.back().get(), str.data(), str.size());
+            return Blocks.back().get();
+        }
+        Blocks.push_back(std::make_shared<char[]>(BlockSize));
+        BlockBytes += BlockSize;
+        Next = Blocks.back().get();
+        Remaining = BlockSize;
+    }
+
+    char* out = Next;
+    std::memcpy(out, str.data(), str.size());
+    Next += str.size();
+    Remaining -= str.size();
+    return out;
+}
+
+StringPool StringPool::snapshot() const {
+    StringPool copy;
+    copy.Strings = Strings;
+    copy.Blocks = Blocks;
+    copy.BlockBytes = BlockBytes;
+    return copy;
+}
+
+void StringPool::rehash(size_t size) {
+    Table.assign(size, None);
+    size_t mask = size - 1;
+    for (Handle handle = 0; handle < Strings.size(); handle++) {
+        size_t i = Strings[handle].hash & mask;
+        while (Table[i] != None) i = (i + 1) & mask;
+        Table[i] = handle;
+    }
+}
+
+void StringPool::reserve(size_t count) {
+    Strings.reserve(count);
+    size_t size = Table.empty() ? 64 : Table.size();
+    while (size < count * 2) size *= 2;
+    if (size != Table.size()) rehash(size);
+}
+
+void StringPool::clear() {
+    Strings.clear();
+    Blocks.clear();
+    Table.clear();
+    BlockBytes = 0;
+    Next = nullptr;
+    Remaining = 0;
+}
+
+size_t StringPool::memoryUsage() const {
+    return BlockBytes + Strings.memoryUsage() + Blocks.capacity() * sizeof(Blocks[0]) + Table.capacity() * sizeof(Handle);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "cow.hpp"
+
+// An append only arena of strings where every distinct string is only stored once
+//
+// A string is named by a 32 bit handle, which is just its position in the order the strings were added,
+// so anything that needs to keep something per string can use a plain vector indexed by handle.
+// The characters are bump allocated out of large blocks that are never moved or freed until clear(),
+// so a view returned by get() stays valid for as long as the pool, or a snapshot of it, does.
+// Nothing is ever removed, so a store that deletes a lot has to rebuild its pool to get the memory back
+class StringPool {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle None = UINT32_MAX;
+
+    StringPool() = default;
+    StringPool(StringPool&&) = default;
+    StringPool& operator=(StringPool&&) = default;
+
+    // returns the handle of an equal string if there already is one, otherwise copies the string in
+    Handle intern(std::string_view str);
+    // returns None if the string is not in the pool
+    Handle find(std::string_view str) const;
+    std::string_view get(Handle handle) const {
+        const Entry& entry = Strings[handle];
+        return {entry.data, entry.length};
+    }
+    // A copy that shares every string with this pool, for reading them while this one keeps adding more.
+    // It can only get strings, it can not find them
+    StringPool snapshot() const;
+
+    size_t size() const { return Strings.size(); }
+    void reserve(size_t count);
+    void clear();
+
+    // bytes allocated for the blocks, the handles and the hash table
+    size_t memoryUsage() const;
+
+private:
+    static constexpr size_t BlockSize = 64 << 10;
+
+    struct Entry {
+        const char* data;
+        uint32_t length;
+        uint32_t hash;
+    };
+
+    CowVector<Entry> Strings;
+    // shared so a snapshot keeps them alive after the pool is cleared or rebuilt
+    std::vector<std::shared_ptr<char[]>> Blocks;
+    size_t BlockBytes = 0;
+    char* Next = nullptr;
+    size_t Remaining = 0;
+
+    // open addressing with linear probing, each slot is a handle or None. Always a power of 2 and at most half full
+    std::vector<Handle> Table;
+
+    static uint32_t hash(std::string_view str);
+    size_t slot(std::string_view str, uint32_t hash) const;
+    const char* copy(std::string_view str);
+    void rehash(size_t size);
+};
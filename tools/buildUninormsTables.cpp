@@ -0,0 +1,277 @@
+// Builds uninormsTables.cpp, the Unicode tables uninorms normalizes with, from the Unicode Character Database
+//
+// Every code point gets one 32 bit entry with everything normalizing needs to know about it, so looking a character
+// up reads one entry instead of a separate table for each property. The entries are kept in a three stage trie: the
+// top bits of a code point pick a row of blocks, the middle bits pick a block from the row and the low bits pick the
+// entry in the block. Identical rows and blocks are only stored once, which is what makes it small, since most of
+// Unicode has no combining class and no decomposition. What is in an entry is described in uninorms.h
+//
+// Build from the repository root with:
+// g++ tools/buildUninormsTables.cpp -std=c++20 -O2 -o buildUninormsTables.out
+//
+// ./buildUninormsTables.out <ucd directory> [output]   (output defaults to uninormsTables.cpp)
+// The directory needs UnicodeData.txt and DerivedNormalizationProps.txt from https://www.unicode.org/Public/<version>/ucd/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char32_t Chars = 0x110000;
+
+// these have to match uninorms.h
+constexpr int BlockBits = 4;
+constexpr int RowBits = 6;
+constexpr uint32_t Stable = 0x100;
+constexpr uint32_t Starter = 0x200;
+constexpr uint32_t Composes = 0x400;
+constexpr uint32_t Decomposes = 0x800;
+constexpr int OffsetShift = 12;
+
+constexpr char32_t SBase = 0xAC00, LBase = 0x1100, VBase = 0x1161, TBase = 0x11A7;
+constexpr char32_t VCount = 21, TCount = 28, NCount = VCount * TCount, SCount = 19 * NCount;
+
+struct Character {
+    uint8_t ccc = 0;
+    // NFC_QC=Y, which is what every character without an NFC_QC line has
+    bool stable = true;
+    bool excluded = false;
+    bool compatibility = false;
+    // the decomposition mapping from UnicodeData.txt, which is only one level deep
+    std::vector<char32_t> mapping;
+};
+
+std::string trim(const std::string& text) {
+    size_t first = text.find_first_not_of(" \t");
+    if (first == std::string::npos) return "";
+    return text.substr(first, text.find_last_not_of(" \t") - first + 1);
+}
+
+std::vector<std::string> split(const std::string& line, char separator) {
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    for (std::string field; std::getline(stream, field, separator);) fields.push_back(trim(field));
+    return fields;
+}
+
+bool readUnicodeData(const std::string& path, std::vector<Character>& characters) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    char32_t rangeStart = 0;
+    for (std::string line; std::getline(file, line);) {
+        std::vector<std::string> fields = split(line, ';');
+        if (fields.size() < 6) continue;
+        char32_t code = std::stoul(fields[0], nullptr, 16);
+        Character& character = characters[code];
+        character.ccc = std::stoi(fields[3]);
+
+        std::stringstream mapping(fields[5]);
+        for (std::string part; mapping >> part;) {
+            // a tag like <compat> or <font> makes it a compatibility decomposition
+            if (part[0] == '<') character.compatibility = true;
+            else character.mapping.push_back(std::stoul(part, nullptr, 16));
+        }
+
+        // big blocks like the CJK ideographs are a First and a Last line, and everything between is the same
+        if (fields[1].ends_with(", First>")) rangeStart = code;
+        if (fields[1].ends_with(", Last>")) {
+            for (char32_t between = rangeStart; between < code; between++) characters[between] = character;
+        }
+    }
+    return true;
+}
+
+// Reads NFC_QC and Full_Composition_Exclusion, and the Unicode version from the first line
+bool readNormalizationProps(const std::string& path, std::vector<Character>& characters, std::string& version) {
+    std::ifstream file(path);
+    if (!file) return false;
+
+    std::string line;
+    std::getline(file, line);
+    size_t dash = line.find('-');
+    if (dash != std::string::npos) version = line.substr(dash + 1, line.find(".txt") - dash - 1);
+
+    while (std::getline(file, line)) {
+        std::vector<std::string> fields = split(line.substr(0, line.find('#')), ';');
+        if (fields.size() < 2) continue;
+
+        size_t dots = fields[0].find("..");
+        char32_t first = std::stoul(fields[0], nullptr, 16);
+        char32_t last = dots == std::string::npos ? first : std::stoul(fields[0].substr(dots + 2), nullptr, 16);
+        for (char32_t code = first; code <= last; code++) {
+            if (fields[1] == "NFC_QC" && fields.size() > 2) characters[code].stable = fields[2] == "Y";
+            if (fields[1] == "Full_Composition_Exclusion") characters[code].excluded = true;
+        }
+    }
+    return true;
+}
+
+bool isHangulSyllable(char32_t code) { return code >= SBase && code < SBase + SCount; }
+
+// The full decomposition, following the mappings all the way down
+void decompose(char32_t code, bool compatibility, const std::vector<Character>& characters, std::vector<char32_t>& out) {
+    if (isHangulSyllable(code)) {
+        char32_t index = code - SBase;
+        out.push_back(LBase + index / NCount);
+        out.push_back(VBase + index % NCount / TCount);
+        if (index % TCount) out.push_back(TBase + index % TCount);
+        return;
+    }
+    const Character& character = characters[code];
+    if (character.mapping.empty() || (character.compatibility && !compatibility)) {
+        out.push_back(code);
+        return;
+    }
+    for (char32_t part : character.mapping) decompose(part, compatibility, characters, out);
+}
+
+template<typename T>
+void writeArray(FILE* out, const char* declaration, const std::vector<T>& values) {
+    std::fprintf(out, "%s = {\n", declaration);
+    for (size_t i = 0; i < values.size(); i += 16) {
+        std::fprintf(out, " ");
+        for (size_t j = i; j < values.size() && j < i + 16; j++) std::fprintf(out, " %lu,", static_cast<unsigned long>(values[j]));
+        std::fprintf(out, "\n");
+    }
+    std::fprintf(out, "};\n\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <ucd directory> [output]\n", argv[0]);
+        return 1;
+    }
+    std::string directory = argv[1];
+    std::string outputPath = argc > 2 ? argv[2] : "uninormsTables.cpp";
+
+    std::vector<Character> characters(Chars);
+    std::string version = "unknown";
+    if (!readUnicodeData(directory + "/UnicodeData.txt", characters)
+        || !readNormalizationProps(directory + "/DerivedNormalizationProps.txt", characters, version)) {
+        std::fprintf(stderr, "could not read UnicodeData.txt and DerivedNormalizationProps.txt from %s\n", directory.c_str());
+        return 1;
+    }
+
+    // the pairs that compose, by their first character. Hangul is done by its formula instead
+    std::map<char32_t, std::vector<std::pair<char32_t, char32_t>>> compositions;
+    for (char32_t code = 0; code < Chars; code++) {
+        const Character& character = characters[code];
+        if (!character.compatibility && character.mapping.size() == 2 && !character.excluded) {
+            compositions[character.mapping[0]].push_back({character.mapping[1], code});
+        }
+    }
+
+    std::vector<uint32_t> entries(Chars);
+    std::vector<std::vector<char32_t>> canonicals(Chars), compatibilities(Chars);
+    for (char32_t code = 0; code < Chars; code++) {
+        const Character& character = characters[code];
+        uint32_t entry = character.ccc;
+        if (character.stable) entry |= Stable;
+
+        std::vector<char32_t>& canonical = canonicals[code];
+        std::vector<char32_t>& compatibility = compatibilities[code];
+        decompose(code, false, characters, canonical);
+        decompose(code, true, characters, compatibility);
+        // a sequence can start at the character if what it decomposes to starts with a stable starter, since only
+        // characters with NFC_QC=M compose with the one before them
+        if (!characters[canonical[0]].ccc && characters[canonical[0]].stable) entry |= Starter;
+
+        // Hangul syllables are decomposed by their formula, so they need no record
+        if (isHangulSyllable(code)) canonical = compatibility = {code};
+        if (canonical == std::vector<char32_t>{code}) canonical.clear();
+        if (compatibility == std::vector<char32_t>{code} || compatibility == canonical) compatibility.clear();
+        entries[code] = entry;
+    }
+
+    // Each character with a decomposition or compositions has a record in the data: a header with the length of the
+    // canonical decomposition in bits 0-2, the length of the compatibility one in bits 3-7 (0 when it is the same as
+    // the canonical one) and the number of compositions from bit 8, then the decompositions, then the compositions as
+    // pairs of the second character and what they make, sorted by the second character. 0 is left for no record
+    // The records NFC reads go first and the ones only NFKC and NFKD read go after them, so NFC only uses the start
+    std::vector<char32_t> data = {0};
+    for (int pass = 0; pass < 2; pass++) {
+        for (char32_t code = 0; code < Chars; code++) {
+            const std::vector<char32_t>& canonical = canonicals[code];
+            const std::vector<char32_t>& compatibility = compatibilities[code];
+            auto pairs = compositions.find(code);
+            bool forNFC = !canonical.empty() || pairs != compositions.end();
+            if (pass == 0 ? !forNFC : forNFC || compatibility.empty()) continue;
+
+            size_t count = pairs == compositions.end() ? 0 : pairs->second.size();
+            if (canonical.size() > 7 || compatibility.size() > 31 || data.size() >= (1u << (32 - OffsetShift))) {
+                std::fprintf(stderr, "U+%04X does not fit in the table layout\n", static_cast<unsigned>(code));
+                return 1;
+            }
+            entries[code] |= data.size() << OffsetShift | (count ? Composes : 0) | (canonical.empty() ? 0 : Decomposes);
+            data.push_back(canonical.size() | compatibility.size() << 3 | count << 8);
+            data.insert(data.end(), canonical.begin(), canonical.end());
+            data.insert(data.end(), compatibility.begin(), compatibility.end());
+            if (count) {
+                std::sort(pairs->second.begin(), pairs->second.end());
+                for (auto [second, composite] : pairs->second) {
+                    data.push_back(second);
+                    data.push_back(composite);
+                }
+            }
+        }
+    }
+
+    // rows holds a row number for every 2^(BlockBits + RowBits) code points, each row is 2^RowBits offsets of
+    // blocks in the stored entries, and each block is 2^BlockBits entries
+    constexpr size_t BlockSize = size_t(1) << BlockBits;
+    constexpr size_t RowSize = size_t(1) << RowBits;
+    std::vector<uint32_t> storedEntries;
+    std::map<std::vector<uint32_t>, size_t> blockOffsets;
+    std::vector<size_t> blockOfChunk;
+    for (size_t start = 0; start < Chars; start += BlockSize) {
+        std::vector<uint32_t> block(entries.begin() + start, entries.begin() + start + BlockSize);
+        auto [it, added] = blockOffsets.try_emplace(block, storedEntries.size());
+        if (added) storedEntries.insert(storedEntries.end(), block.begin(), block.end());
+        blockOfChunk.push_back(it->second);
+    }
+
+    std::vector<size_t> storedBlocks;
+    std::map<std::vector<size_t>, size_t> rowNumbers;
+    std::vector<size_t> rows;
+    for (size_t start = 0; start < blockOfChunk.size(); start += RowSize) {
+        std::vector<size_t> row(blockOfChunk.begin() + start, blockOfChunk.begin() + start + RowSize);
+        auto [it, added] = rowNumbers.try_emplace(row, rowNumbers.size());
+        if (added) storedBlocks.insert(storedBlocks.end(), row.begin(), row.end());
+        rows.push_back(it->second);
+    }
+
+    if (rowNumbers.size() > 256 || storedEntries.size() > 65536) {
+        std::fprintf(stderr, "%zu rows and %zu entries do not fit in the index types\n", rowNumbers.size(), storedEntries.size());
+        return 1;
+    }
+
+    FILE* out = std::fopen(outputPath.c_str(), "w");
+    if (!out) {
+        std::fprintf(stderr, "could not write %s\n", outputPath.c_str());
+        return 1;
+    }
+    std::fprintf(out, "// Generated by tools/buildUninormsTables.cpp from the Unicode Character Database %s\n", version.c_str());
+    std::fprintf(out, "// Do not edit this by hand, run the tool again instead\n\n");
+    std::fprintf(out, "#include \"uninorms.h\"\n\nnamespace ufal {\nnamespace unilib {\n\n");
+    writeArray(out, "const uint8_t uninorms::trie_rows[uninorms::CHARS >> (uninorms::TRIE_BLOCK_BITS + uninorms::TRIE_ROW_BITS)]", rows);
+    writeArray(out, "const uint16_t uninorms::trie_blocks[]", storedBlocks);
+    // a block is one cache line, so a character's entry never spans two of them
+    writeArray(out, "alignas(64) const uint32_t uninorms::trie_entries[]", storedEntries);
+    writeArray(out, "const char32_t uninorms::normalization_data[]", data);
+    std::fprintf(out, "} // namespace unilib\n} // namespace ufal\n");
+    std::fclose(out);
+
+    size_t bytes = rows.size() + storedBlocks.size() * 2 + storedEntries.size() * 4 + data.size() * 4;
+    std::printf("Unicode %s: %zu rows, %zu blocks, %zu bytes of data, %zu bytes in all\n", version.c_str(), rowNumbers.size(),
+        blockOffsets.size(), data.size() * 4, bytes);
+    return 0;
+}
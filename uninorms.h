@@ -25,6 +25,30 @@ class uninorms {
   static void nfkc(std::u32string& str);
   static void nfkd(std::u32string& str);
 
+  // NFC quick check. Strings already in NFC, such as plain ASCII, are left untouched by nfc_if_needed.
+  static bool is_nfc(const std::u32string& str);
+  static void nfc_if_needed(std::u32string& str);
+
+  // The pieces of nfc for normalizers that work one combining sequence at a time, like decodeUTF8NFC in utf8.cpp.
+  // nfc_properties gives the canonical combining class in the low 8 bits, NFC_STABLE if the quick check allows the
+  // character in NFC, and NFC_STARTER if a new combining sequence starts at it, which is when its decomposition starts
+  // with a character of class 0 that never composes with the one before.
+  enum { NFC_STABLE = 0x100, NFC_STARTER = 0x200 };
+  static const int MAX_DECOMPOSITION = 4;
+  static unsigned nfc_properties(char32_t chr) {
+    // Non-Unicode characters are left alone by nfc, so they behave like starters.
+    if (chr >= CHARS) return NFC_STABLE | NFC_STARTER;
+    return trie_entry(chr) & (0xFF | NFC_STABLE | NFC_STARTER);
+  }
+  static unsigned ccc(char32_t chr) {
+    // Nothing below the combining diacritics has a combining class.
+    return chr < 0x300 || chr >= CHARS ? 0 : trie_entry(chr) & 0xFF;
+  }
+  // Writes the canonical decomposition of chr, at most MAX_DECOMPOSITION characters, and returns its length.
+  static int canonical_decomposition(char32_t chr, char32_t* out);
+  // Composes a decomposed and reordered sequence in place and returns its new length.
+  static size_t compose(char32_t* str, size_t size);
+
  private:
   static void compose(std::u32string& str);
   static void decompose(std::u32string& str, bool kanonical);
@@ -37,16 +61,33 @@ class uninorms {
     static const char32_t LCount = 19, VCount = 21, TCount = 28, NCount = VCount * TCount, SCount = LCount * NCount;
   };
 
-  static const uint8_t ccc_index[CHARS >> 8];
-  static const uint8_t ccc_block[][256];
-
-  static const uint8_t composition_index[CHARS >> 8];
-  static const uint16_t composition_block[][257];
-  static const char32_t composition_data[];
+  // Every code point has one 32 bit entry with the canonical combining class in bits 0-7, NFC_STABLE, NFC_STARTER,
+  // COMPOSES if it is the first character of any composition, DECOMPOSES if it has a canonical decomposition, and
+  // from bit 12 the offset of its record in normalization_data, or 0 if it has no decomposition and no compositions.
+  // The entries are in a three stage trie generated into uninormsTables.cpp by tools/buildUninormsTables.cpp, which
+  // also describes the records. A block of entries is one cache line, and the rows and blocks above it are small
+  // enough to stay in the cache, so looking up a character costs one read that can miss.
+  enum { COMPOSES = 0x400, DECOMPOSES = 0x800 };
+  static const int TRIE_BLOCK_BITS = 4, TRIE_ROW_BITS = 6, RECORD_SHIFT = 12;
+  static const uint8_t trie_rows[CHARS >> (TRIE_BLOCK_BITS + TRIE_ROW_BITS)];
+  static const uint16_t trie_blocks[];
+  static const uint32_t trie_entries[];
+  static const char32_t normalization_data[];
 
-  static const uint8_t decomposition_index[CHARS >> 8];
-  static const uint16_t decomposition_block[][257];
-  static const char32_t decomposition_data[];
+  static uint32_t trie_entry(char32_t chr) {
+    unsigned row = trie_rows[chr >> (TRIE_BLOCK_BITS + TRIE_ROW_BITS)];
+    unsigned block = trie_blocks[row << TRIE_ROW_BITS | ((chr >> TRIE_BLOCK_BITS) & ((1 << TRIE_ROW_BITS) - 1))];
+    return trie_entries[block + (chr & ((1 << TRIE_BLOCK_BITS) - 1))];
+  }
+  static const char32_t* record(uint32_t entry) {
+    return entry >> RECORD_SHIFT ? normalization_data + (entry >> RECORD_SHIFT) : nullptr;
+  }
+  // The decomposition of the character with this entry and its length, 0 if it does not decompose. Hangul syllables
+  // are not in the tables.
+  static int decomposition(uint32_t entry, bool kompatibility, const char32_t*& data);
+  // The compositions the character with this entry is the first character of, as pairs of the second character and
+  // the composition.
+  static size_t compositions(uint32_t entry, const char32_t*& pairs);
 };
 
 } // namespace unilib
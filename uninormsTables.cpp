@@ -0,0 +1,1910 @@
+// Generated by tools/buildUninormsTables.cpp from the Unicode Character Database 13.0.0
+// Do not edit this by hand, run the tool again instead
+
+#include "uninorms.h"
+
+namespace ufal {
+namespace unilib {
+
+const uint8_t uninorms::trie_rows[uninorms::CHARS >> (uninorms::TRIE_BLOCK_BITS + uninorms::TRIE_ROW_BITS)] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 15, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 16, 17,
+  18, 13, 19, 20, 21, 22, 23, 24, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 26, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 27,
+  13, 13, 13, 13, 28, 29, 13, 13, 30, 13, 31, 32, 33, 13, 34, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 35, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+};
+
+const uint16_t uninorms::trie_blocks[] = {
+  0, 0, 0, 16, 32, 48, 64, 80, 0, 0, 96, 112, 128, 144, 160, 176,
+  192, 208, 224, 240, 256, 272, 288, 304, 0, 0, 320, 336, 352, 368, 384, 400,
+  416, 432, 448, 464, 0, 0, 0, 0, 0, 480, 0, 496, 0, 512, 528, 0,
+  544, 560, 576, 592, 608, 624, 640, 656, 672, 688, 704, 720, 736, 752, 0, 768,
+  784, 800, 816, 832, 848, 864, 0, 880, 896, 0, 0, 0, 912, 928, 944, 960,
+  0, 0, 0, 0, 0, 0, 0, 0, 976, 992, 1008, 1024, 1040, 0, 0, 0,
+  0, 1056, 1072, 0, 1088, 1104, 0, 1120, 0, 0, 0, 0, 1136, 1152, 1168, 0,
+  0, 1184, 0, 1200, 1216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1232, 1248,
+  0, 1264, 1280, 0, 0, 1296, 0, 0, 0, 0, 0, 0, 0, 1312, 1328, 1344,
+  0, 0, 1360, 1376, 1392, 1408, 0, 0, 0, 0, 0, 1424, 1440, 1456, 0, 1472,
+  0, 0, 0, 1488, 1392, 1504, 0, 0, 0, 0, 0, 1520, 1392, 0, 0, 0,
+  0, 0, 0, 1424, 1536, 1552, 0, 0, 0, 1568, 0, 1584, 1600, 1616, 0, 0,
+  0, 0, 0, 0, 1632, 1648, 0, 0, 0, 0, 0, 1664, 1680, 1696, 0, 0,
+  0, 0, 0, 1712, 1728, 1616, 0, 0, 0, 0, 0, 0, 1744, 1760, 0, 0,
+  0, 0, 0, 1776, 1792, 0, 0, 0, 0, 0, 0, 1808, 1824, 1840, 0, 0,
+  1856, 1872, 0, 1888, 1904, 1920, 1936, 1952, 1968, 1984, 2000, 2016, 2032, 0, 0, 0,
+  0, 0, 2048, 2064, 0, 0, 0, 0, 2080, 0, 0, 0, 0, 0, 0, 2096,
+  0, 0, 0, 0, 0, 0, 2112, 2128, 0, 0, 2144, 2160, 2176, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 2192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2208, 0, 2208, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2224, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2240, 0, 0, 0, 0, 0,
+  0, 0, 0, 2256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2272, 0, 0, 0, 0, 2288, 2304, 0, 0, 0, 2320, 2336, 0, 0, 0,
+  2352, 2368, 0, 2384, 2400, 0, 2416, 2432, 0, 0, 2448, 0, 0, 0, 2464, 2480,
+  0, 0, 0, 2496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2512, 2528, 2544,
+  0, 0, 2560, 2576, 2592, 2608, 2624, 2640, 0, 2656, 2672, 2688, 2704, 2720, 2736, 2752,
+  2768, 2784, 2800, 2816, 2832, 2848, 2864, 2880, 2896, 2912, 2928, 2944, 2960, 2976, 2992, 3008,
+  3024, 3040, 3056, 3072, 3088, 3104, 3120, 3136, 3152, 3168, 3184, 3200, 3216, 3232, 3248, 3264,
+  3280, 3296, 3312, 3328, 3344, 3360, 0, 3376, 3392, 3408, 3424, 0, 0, 3440, 3456, 3472,
+  3488, 3504, 3520, 3536, 3552, 3568, 3584, 3600, 3616, 3632, 3648, 0, 3664, 3680, 0, 0,
+  3696, 0, 3712, 3728, 3744, 0, 3760, 3776, 3792, 3808, 3824, 3840, 0, 0, 3856, 0,
+  0, 0, 3872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 3888, 3904, 3920, 3936, 3952, 3968, 3984, 4000, 4016, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4032, 0, 0, 0, 0, 0, 0, 4048, 0, 0, 0, 0, 0, 4064, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 4080, 0, 0, 0, 0, 0, 0, 4096, 4112,
+  0, 0, 0, 0, 0, 0, 4128, 4144, 0, 0, 0, 0, 0, 0, 2736, 2736,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 4160, 0, 0, 0, 0, 0, 4176,
+  4192, 4208, 4224, 4240, 4256, 4272, 4288, 4304, 4320, 4336, 4352, 4368, 4384, 4400, 0, 0,
+  4416, 0, 4432, 4448, 4464, 4480, 4496, 4512, 0, 4528, 4544, 4560, 4576, 4592, 4608, 4624,
+  0, 0, 0, 4640, 4656, 4672, 4688, 4704, 4720, 4736, 0, 0, 0, 0, 0, 0,
+  4752, 4768, 4784, 4800, 4816, 4832, 4848, 4864, 4880, 4896, 4912, 4928, 4944, 4960, 4976, 4992,
+  5008, 5024, 5040, 5056, 5072, 5088, 5104, 5120, 5136, 5152, 5168, 5184, 5200, 5216, 5232, 5248,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 4096, 5264, 0, 5280, 0, 0, 0, 0, 0, 4112,
+  0, 0, 0, 0, 0, 0, 0, 5296, 0, 0, 0, 0, 0, 0, 0, 5312,
+  5328, 0, 5344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2208, 0, 2736, 4112,
+  0, 0, 5360, 0, 0, 5376, 0, 0, 0, 0, 0, 5392, 2288, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5408, 5424, 0, 0, 5328,
+  0, 0, 0, 0, 0, 5440, 5456, 0, 0, 0, 0, 0, 0, 0, 1392, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5472, 5488, 5504, 5520, 5536, 5552, 5568, 5584, 5600, 5616, 5632, 5648, 5664, 5680, 5696, 5712,
+  5728, 5744, 5760, 5776, 5792, 5808, 5824, 5840, 5856, 5872, 5888, 5904, 5920, 5936, 0, 0,
+  5952, 5968, 5984, 6000, 6016, 6032, 6048, 6064, 6080, 6096, 6112, 6128, 0, 6144, 6160, 6176,
+  6192, 6208, 6224, 6240, 6256, 6272, 6288, 6304, 6320, 6336, 6352, 6368, 6384, 6400, 6416, 6432,
+  6448, 6464, 6480, 6496, 0, 6512, 6528, 6544, 6560, 6576, 6592, 6608, 6624, 0, 0, 6640,
+  0, 6656, 6672, 6688, 6704, 6720, 6736, 6752, 6768, 6784, 6800, 6816, 6832, 6848, 6864, 6880,
+  6896, 6912, 6928, 6944, 6960, 6976, 6992, 7008, 7024, 7040, 7056, 7072, 7088, 7104, 7120, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2080,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2336, 0,
+  0, 0, 0, 0, 0, 0, 0, 7136, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7152, 0, 0, 7168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7184, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 7200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7216, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7232, 2336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5328, 0, 0, 4144, 0, 7248, 7264, 7280, 0, 0, 0, 0,
+  7296, 0, 7312, 7328, 0, 0, 0, 5392, 0, 0, 0, 0, 7344, 0, 0, 0,
+  0, 0, 0, 7360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7376, 0,
+  0, 0, 0, 7392, 7408, 1616, 7424, 7440, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7456, 1472, 0, 0, 0, 0, 0, 7472, 7488, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7504, 7520, 7536, 0, 0, 0,
+  0, 0, 0, 4144, 0, 0, 0, 0, 0, 0, 0, 7552, 0, 0, 0, 0,
+  0, 0, 7568, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 7584, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 7600, 5392, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2288, 0,
+  0, 0, 0, 2208, 7616, 0, 0, 0, 0, 7632, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 4144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7648, 0, 0, 0, 0, 7616, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7664,
+  0, 0, 0, 7680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7696,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 7712, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 7728, 7744, 7760, 7776, 0, 7792, 7808, 7824, 0, 0, 0,
+  0, 0, 0, 0, 7840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7856, 7872, 7888, 7904, 7920, 7936, 7952, 7968, 7984, 8000, 8016, 8032, 8048, 8064, 8080, 8096,
+  8112, 8128, 8144, 8160, 8176, 8192, 8208, 8224, 8240, 8256, 8272, 8288, 8304, 8320, 8336, 8352,
+  8368, 8384, 8400, 8416, 8432, 8448, 8464, 8480, 8496, 8512, 8528, 8544, 8560, 8576, 8592, 8608,
+  8624, 8640, 8656, 8672, 8688, 8704, 8720, 8736, 8752, 8768, 8784, 8800, 8816, 8832, 8848, 8864,
+  8880, 8896, 8912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 7680, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8928, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8944, 0, 0,
+  0, 0, 0, 0, 8960, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  8976, 8992, 9008, 9024, 9040, 9056, 9072, 9088, 9104, 9120, 9136, 9152, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9168, 9184, 9200, 9216, 9232, 0, 9248, 0, 0, 9264, 0, 0, 0, 0, 0, 0,
+  9280, 9296, 9312, 9328, 9344, 9360, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9376,
+  9392, 9408, 9424, 9440, 9456, 9472, 9488, 9504, 9520, 9536, 9552, 9568, 9584, 9600, 9616, 9632,
+  9648, 9664, 9680, 9696, 9712, 9728, 9744, 9760, 9776, 9792, 9808, 9824, 9840, 9856, 9872, 9888,
+  9904, 9920, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+alignas(64) const uint32_t uninorms::trie_entries[] = {
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 5888, 18176, 30464, 768,
+  768, 42752, 177920, 206592, 251648, 304896, 448256, 460544, 521984, 583424, 710400, 722688, 767744, 820992, 849664, 927488,
+  1062656, 768, 1083136, 1152768, 1214208, 1275648, 1435392, 1455872, 1509120, 1529600, 1607424, 768, 768, 768, 768, 768,
+  768, 1660672, 1795840, 1824512, 1869568, 1922816, 2066176, 2078464, 2139904, 2209536, 2328320, 2348800, 2393856, 2447104, 2475776, 2553600,
+  2688768, 768, 2709248, 2778880, 2840320, 2909952, 3069696, 3090176, 3151616, 3172096, 3258112, 768, 768, 768, 768, 768,
+  31298304, 768, 768, 768, 768, 768, 768, 768, 3311360, 768, 31306496, 768, 768, 768, 768, 31314688,
+  768, 768, 31326976, 31335168, 31343360, 31355648, 768, 768, 31363840, 31376128, 31384320, 768, 31392512, 31408896, 31425280, 768,
+  3349248, 3361536, 3374848, 3418880, 3432192, 3452672, 3471104, 3493632, 3513088, 3525376, 3538688, 3582720, 3595008, 3607296, 3619584, 3632896,
+  768, 3652352, 3664640, 3676928, 3690240, 3735296, 3772160, 768, 3790592, 3803904, 3816192, 3828480, 3841792, 3885824, 768, 768,
+  3898112, 3910400, 3923712, 3967744, 3981056, 4001536, 4019968, 4042496, 4061952, 4074240, 4087552, 4131584, 4143872, 4156160, 4168448, 4181760,
+  768, 4201216, 4213504, 4225792, 4239104, 4284160, 4321024, 768, 4339456, 4352768, 4365056, 4377344, 4390656, 4434688, 768, 4446976,
+  4459264, 4471552, 4484864, 4529920, 4573952, 4586240, 4598528, 4610816, 4623104, 4635392, 4647680, 4659968, 4672256, 4684544, 4696832, 4709120,
+  768, 768, 4722432, 4751104, 4778752, 4791040, 4803328, 4815616, 4827904, 4840192, 4852480, 4864768, 4877056, 4889344, 4901632, 4913920,
+  4926208, 4938496, 4950784, 4963072, 4975360, 4987648, 768, 768, 4999936, 5012224, 5024512, 5036800, 5049088, 5061376, 5073664, 5085952,
+  5098240, 768, 31441664, 31453952, 5110528, 5122816, 5135104, 5147392, 768, 5159680, 5171968, 5184256, 5196544, 5208832, 5221120, 31466240,
+  31478528, 768, 768, 5233408, 5245696, 5257984, 5270272, 5282560, 5294848, 31490816, 768, 768, 5308160, 5336832, 5364480, 5376768,
+  5389056, 5401344, 768, 768, 5413632, 5425920, 5438208, 5450496, 5462784, 5475072, 5488384, 5508864, 5528320, 5540608, 5552896, 5565184,
+  5578496, 5598976, 5618432, 5630720, 5643008, 5655296, 768, 768, 5668608, 5689088, 5709568, 5730048, 5749504, 5761792, 5774080, 5786368,
+  5798656, 5810944, 5823232, 5835520, 5847808, 5860096, 5872384, 5884672, 5896960, 5909248, 5921536, 5933824, 5946112, 5958400, 5970688, 5981952,
+  6000384, 6053632, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 6106880,
+  6160128, 768, 768, 768, 768, 768, 768, 6211328, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 31503104, 31519488, 31535872, 31552256, 31564544, 31576832, 31589120, 31601408, 31613696, 6224640, 6236928, 6249216,
+  6261504, 6273792, 6286080, 6298368, 6310656, 6322944, 6339328, 6355712, 6372096, 6388480, 6404864, 6421248, 6437632, 768, 6454016, 6470400,
+  6486784, 6503168, 6519552, 6531840, 768, 768, 6544128, 6556416, 6568704, 6580992, 6594304, 6614784, 6634240, 6650624, 6667008, 6679296,
+  6691584, 31625984, 31638272, 31650560, 6703872, 6716160, 768, 768, 6728448, 6740736, 6753024, 6769408, 6785792, 6798080, 6810368, 6822656,
+  6834944, 6847232, 6859520, 6871808, 6884096, 6896384, 6908672, 6920960, 6933248, 6945536, 6957824, 6970112, 6982400, 6994688, 7006976, 7019264,
+  7031552, 7043840, 7056128, 7068416, 7080704, 7092992, 7105280, 7117568, 7129856, 7142144, 7154432, 7166720, 768, 768, 7179008, 7191296,
+  768, 768, 768, 768, 768, 768, 7204608, 7225088, 7245568, 7266048, 7285504, 7301888, 7318272, 7334656, 7352064, 7372544,
+  7392000, 7408384, 7424768, 7437056, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 7448320, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  31662848, 31671040, 31679232, 31687424, 31695616, 31703808, 31712000, 31720192, 31728384, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 31736576, 31748864, 31761152, 31773440, 31785728, 31798016, 768, 768,
+  31810304, 31818496, 31826688, 31834880, 31843072, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  230, 230, 230, 230, 230, 486, 230, 230, 230, 230, 230, 230, 230, 486, 486, 230,
+  486, 230, 486, 230, 230, 488, 476, 476, 476, 476, 488, 216, 476, 476, 476, 476,
+  476, 458, 458, 220, 220, 220, 220, 202, 202, 476, 476, 476, 476, 220, 220, 476,
+  220, 220, 476, 476, 257, 257, 257, 257, 1, 476, 476, 476, 476, 486, 486, 486,
+  7461094, 7469286, 230, 7477478, 7485670, 240, 486, 476, 476, 476, 486, 486, 486, 476, 476, 768,
+  486, 486, 486, 476, 476, 476, 476, 486, 488, 476, 476, 486, 489, 490, 490, 489,
+  490, 490, 489, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+  768, 768, 768, 768, 7498240, 768, 768, 768, 768, 768, 31851264, 768, 768, 768, 7506432, 768,
+  768, 768, 768, 768, 31863552, 7514880, 7539456, 7551488, 7559936, 7572224, 7584512, 768, 7596800, 768, 7609088, 7621376,
+  7633664, 7649024, 768, 768, 768, 7710464, 768, 7747328, 768, 7792384, 768, 768, 768, 768, 768, 7853824,
+  768, 7890688, 768, 768, 768, 7902976, 768, 768, 768, 7956224, 8002304, 8014592, 8027904, 8047360, 8060672, 8080128,
+  8092416, 8107776, 768, 768, 768, 8177408, 768, 8214272, 768, 8267520, 768, 768, 768, 768, 768, 8337152,
+  768, 8374016, 768, 768, 768, 8394496, 768, 768, 768, 8464128, 8519424, 8556288, 8592128, 8604416, 8617728, 768,
+  31875840, 31884032, 8636160, 8661760, 8682240, 31892224, 31900416, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  31908608, 31916800, 31924992, 768, 31933184, 31941376, 768, 768, 768, 31949568, 768, 768, 768, 768, 768, 768,
+  8702720, 8715008, 768, 8727296, 768, 768, 8738560, 8751872, 768, 768, 768, 768, 8764160, 8776448, 8788736, 768,
+  8800000, 768, 768, 8820480, 768, 8832768, 8861440, 8881920, 8894208, 8932096, 8943360, 768, 768, 768, 8955648, 768,
+  768, 768, 768, 8967936, 768, 768, 768, 9004800, 768, 768, 768, 9017088, 768, 9029376, 768, 768,
+  9041664, 768, 768, 9062144, 768, 9074432, 9103104, 9123584, 9135872, 9173760, 9185024, 768, 768, 768, 9197312, 768,
+  768, 768, 768, 9209600, 768, 768, 768, 9246464, 768, 768, 768, 9258752, 768, 9271040, 768, 768,
+  9284352, 9296640, 768, 9308928, 768, 768, 9320192, 9333504, 768, 768, 768, 768, 9345792, 9358080, 9370368, 768,
+  768, 768, 768, 768, 9381632, 9393920, 9407232, 9419520, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 486, 486, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 9431808, 9444096, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  9456384, 9468672, 9480960, 9493248, 768, 768, 9505536, 9517824, 9529088, 9541376, 9554688, 9566976, 9579264, 9591552, 9603840, 9616128,
+  768, 768, 9628416, 9640704, 9652992, 9665280, 9677568, 9689856, 9701120, 9713408, 9726720, 9739008, 9751296, 9763584, 9775872, 9788160,
+  9800448, 9812736, 9825024, 9837312, 9849600, 9861888, 768, 768, 9874176, 9886464, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 31957760, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 476, 486, 486, 486, 486, 476, 486, 486, 486, 478, 476, 486, 486, 486, 486,
+  486, 486, 476, 476, 476, 476, 476, 476, 486, 486, 476, 486, 486, 478, 484, 486,
+  266, 267, 268, 269, 270, 271, 272, 273, 274, 275, 275, 276, 277, 278, 768, 279,
+  768, 280, 281, 768, 486, 476, 768, 274, 768, 768, 768, 768, 768, 768, 768, 768,
+  486, 486, 486, 486, 486, 486, 486, 486, 286, 287, 288, 768, 768, 768, 768, 768,
+  768, 768, 9898752, 9911040, 9923328, 9935616, 9947904, 9959168, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 9987840, 768, 10000128, 283, 284, 285, 286, 287,
+  288, 289, 290, 230, 230, 220, 476, 486, 486, 486, 486, 486, 476, 486, 486, 476,
+  291, 768, 768, 768, 768, 31970048, 31982336, 31994624, 32006912, 768, 768, 768, 768, 768, 768, 768,
+  10013440, 10024704, 10038016, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 10049280, 10062592, 768, 10073856, 486, 486, 486, 486, 486, 486, 486, 768, 768, 486,
+  486, 486, 486, 476, 486, 768, 768, 486, 486, 768, 476, 486, 486, 476, 768, 768,
+  768, 292, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  486, 476, 486, 486, 476, 486, 486, 476, 476, 476, 486, 476, 476, 486, 476, 486,
+  486, 486, 476, 486, 476, 486, 476, 486, 476, 486, 486, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 486, 486, 486, 486,
+  486, 486, 476, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 476, 768, 768,
+  768, 768, 768, 768, 768, 768, 486, 486, 486, 486, 768, 486, 486, 486, 486, 486,
+  486, 486, 486, 486, 768, 486, 486, 486, 768, 486, 486, 486, 486, 486, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 476, 476, 476, 768, 768, 768, 768,
+  768, 768, 768, 476, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+  486, 486, 768, 476, 486, 486, 476, 486, 486, 476, 486, 486, 486, 476, 476, 476,
+  283, 284, 285, 486, 486, 486, 476, 486, 486, 476, 476, 486, 486, 486, 486, 486,
+  768, 768, 768, 768, 768, 768, 768, 768, 10086144, 10099456, 768, 768, 768, 768, 768, 768,
+  10110720, 10124032, 768, 10135296, 10148608, 768, 768, 768, 768, 768, 768, 768, 7, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 768, 768,
+  768, 486, 476, 486, 486, 768, 768, 768, 10160640, 10172928, 10185216, 10197504, 10209792, 10222080, 10234368, 10246656,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 10258176, 768, 768, 768, 10279680, 10291968, 265, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 10304000, 10316288, 768, 10328576,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 768,
+  768, 768, 768, 10340864, 768, 768, 10353152, 768, 768, 768, 768, 768, 263, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 10365440, 10377728, 10390016, 768, 768, 10402304, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 10413824, 10443520, 768, 768, 10455808, 10468096, 265, 768, 768,
+  768, 768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 10480128, 10492416, 768, 768,
+  768, 768, 10503936, 768, 10517248, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 10528512, 10548992, 768, 768, 10562304, 10574592, 10586880, 265, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 10598144, 768, 10611456, 768, 768, 768, 768, 265, 768, 768,
+  768, 768, 768, 768, 768, 340, 91, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 768, 768, 10622720,
+  10636032, 768, 0, 768, 768, 768, 10647296, 10676992, 10689280, 768, 10702592, 10722048, 768, 265, 768, 768,
+  768, 768, 768, 768, 768, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 265, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 10737408, 10757888, 768, 768, 10771200, 10783488, 10795776, 265, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 9, 768, 768, 768, 768, 0,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 10807040, 10836736, 768, 10850048, 10869504, 10885888, 0,
+  768, 768, 768, 32019200, 768, 768, 768, 768, 359, 359, 265, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 363, 363, 363, 363, 768, 768, 768, 768,
+  768, 768, 768, 32031488, 768, 768, 768, 768, 374, 374, 265, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 378, 378, 378, 378, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 32043776, 32056064, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 32068352, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 476, 476, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 476, 768, 476, 768, 472, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 10897920, 768, 768, 768, 768, 768, 768, 768, 768, 768, 10910208, 768, 768,
+  768, 768, 10922496, 768, 768, 768, 768, 10934784, 768, 768, 768, 768, 10947072, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 10959360, 768, 768, 768, 768, 768, 768,
+  768, 385, 386, 10971136, 388, 10983424, 10996224, 32076544, 11008512, 32092928, 386, 386, 386, 386, 768, 768,
+  386, 11020288, 486, 486, 265, 768, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 11033088, 768, 768, 768, 768, 768, 768, 768, 768, 768, 11045376, 768, 768,
+  768, 768, 11057664, 768, 768, 768, 768, 11069952, 768, 768, 768, 768, 11082240, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 11094528, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 476, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 11106048, 11119360, 768, 768, 768, 768, 768, 768, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 263, 768, 265, 265, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 476, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 32109312, 768, 768, 768,
+  768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 486, 486,
+  768, 768, 768, 768, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 484, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 478, 486, 476, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 486, 476, 768, 768, 768, 768, 768, 768, 768,
+  265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 486, 486, 486, 486, 486, 486, 486, 486, 768, 768, 476,
+  486, 486, 486, 486, 486, 476, 476, 476, 476, 476, 476, 486, 486, 476, 768, 476,
+  476, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 11130624, 11143936, 11155200, 11168512, 11179776, 11193088, 11204352, 11217664, 11228928, 11242240, 768,
+  768, 11253504, 11266816, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 263, 0, 768, 768, 768, 768, 11278080, 11291392, 11302656, 11315968, 11327232, 11339520,
+  11352832, 11365120, 11376384, 11389696, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 476, 486, 486, 486,
+  486, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 265, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 263, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 265, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 263, 768, 768, 768, 768, 768, 768, 768, 768,
+  486, 486, 486, 768, 257, 476, 476, 476, 476, 476, 486, 486, 476, 476, 476, 476,
+  486, 768, 257, 257, 257, 257, 257, 257, 257, 768, 768, 768, 768, 476, 768, 768,
+  768, 768, 768, 768, 486, 768, 768, 768, 486, 486, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 32117504, 32125696, 32133888, 768,
+  32142080, 32150272, 32158464, 32166656, 32174848, 32183040, 32191232, 32199424, 32207616, 32215808, 32224000, 768, 32232192, 32240384, 32248576, 32256768,
+  32264960, 32273152, 32281344, 32289536, 32297728, 32305920, 32314112, 32322304, 32330496, 32338688, 32346880, 32355072, 32363264, 32371456, 768, 32379648,
+  32387840, 32396032, 32404224, 32412416, 32420608, 32428800, 32436992, 32445184, 32453376, 32461568, 32469760, 32477952, 32486144, 32494336, 32502528, 32510720,
+  32518912, 32527104, 32535296, 32543488, 32551680, 32559872, 32568064, 32576256, 32584448, 32592640, 32600832, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 32609024, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 32617216, 32625408, 32633600, 32641792, 32649984,
+  32658176, 32666368, 32674560, 32682752, 32690944, 32699136, 32707328, 32715520, 32723712, 32731904, 32740096, 32748288, 32756480, 32764672, 32772864, 32781056,
+  32789248, 32797440, 32805632, 32813824, 32822016, 32830208, 32838400, 32846592, 32854784, 32862976, 32871168, 32879360, 32887552, 32895744, 32903936, 32912128,
+  486, 486, 476, 486, 486, 486, 486, 486, 486, 486, 476, 486, 486, 490, 470, 476,
+  458, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+  486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486,
+  486, 486, 486, 486, 486, 486, 488, 484, 484, 476, 768, 486, 489, 476, 486, 476,
+  11401984, 11414272, 11426560, 11438848, 11451136, 11463424, 11475712, 11488000, 11500288, 11516672, 11533056, 11545344, 11557632, 11569920, 11582208, 11594496,
+  11606784, 11619072, 11631360, 11643648, 11655936, 11672320, 11688704, 11705088, 11721472, 11733760, 11746048, 11758336, 11770624, 11787008, 11803392, 11815680,
+  11827968, 11840256, 11852544, 11864832, 11877120, 11889408, 11901696, 11913984, 11926272, 11938560, 11950848, 11963136, 11975424, 11987712, 12000000, 12016384,
+  12032768, 12045056, 12057344, 12069632, 12081920, 12094208, 12107520, 12128000, 12147456, 12163840, 12180224, 12192512, 12204800, 12217088, 12229376, 12241664,
+  12253952, 12266240, 12278528, 12290816, 12303104, 12315392, 12327680, 12339968, 12352256, 12364544, 12376832, 12389120, 12401408, 12417792, 12434176, 12450560,
+  12466944, 12483328, 12499712, 12516096, 12532480, 12544768, 12557056, 12569344, 12581632, 12593920, 12607232, 12627712, 12647168, 12663552, 12679936, 12692224,
+  12704512, 12716800, 12730112, 12750592, 12770048, 12786432, 12802816, 12819200, 12835584, 12851968, 12868352, 12880640, 12892928, 12905216, 12917504, 12929792,
+  12942080, 12954368, 12966656, 12978944, 12991232, 13003520, 13015808, 13028096, 13040384, 13056768, 13073152, 13089536, 13105920, 13118208, 13130496, 13142784,
+  13155072, 13167360, 13179648, 13191936, 13204224, 13216512, 13228800, 13241088, 13253376, 13265664, 13277952, 13290240, 13302528, 13314816, 13327104, 13339392,
+  13351680, 13363968, 13376256, 13388544, 13400832, 13413120, 13425408, 13437696, 13449984, 13462272, 32920320, 13474560, 768, 768, 768, 768,
+  13496064, 13524736, 13552384, 13564672, 13576960, 13593344, 13609728, 13626112, 13642496, 13658880, 13675264, 13691648, 13708032, 13724416, 13740800, 13757184,
+  13773568, 13789952, 13806336, 13822720, 13839104, 13855488, 13871872, 13888256, 13905664, 13926144, 13945600, 13957888, 13970176, 13982464, 13994752, 14011136,
+  14027520, 14043904, 14060288, 14076672, 14093056, 14109440, 14125824, 14142208, 14158592, 14170880, 14183168, 14195456, 14208768, 14229248, 14248704, 14260992,
+  14273280, 14289664, 14306048, 14322432, 14338816, 14355200, 14371584, 14387968, 14404352, 14420736, 14437120, 14453504, 14469888, 14486272, 14502656, 14519040,
+  14535424, 14551808, 14568192, 14584576, 14600960, 14613248, 14625536, 14637824, 14650112, 14666496, 14682880, 14699264, 14715648, 14732032, 14748416, 14764800,
+  14781184, 14797568, 14813952, 14826240, 14838528, 14850816, 14863104, 14875392, 14887680, 14899968, 768, 768, 768, 768, 768, 768,
+  14913280, 14958336, 15003392, 15027968, 15052544, 15077120, 15101696, 15126272, 15150848, 15195904, 15240960, 15265536, 15290112, 15314688, 15339264, 15363840,
+  15388416, 15417088, 15444736, 15461120, 15477504, 15493888, 768, 768, 15511296, 15539968, 15567616, 15584000, 15600384, 15616768, 768, 768,
+  15634176, 15679232, 15724288, 15748864, 15773440, 15798016, 15822592, 15847168, 15871744, 15916800, 15961856, 15986432, 16011008, 16035584, 16060160, 16084736,
+  16109312, 16146176, 16182016, 16198400, 16214784, 16231168, 16247552, 16263936, 16281344, 16318208, 16354048, 16370432, 16386816, 16403200, 16419584, 16435968,
+  16453376, 16482048, 16509696, 16526080, 16542464, 16558848, 768, 768, 16576256, 16604928, 16632576, 16648960, 16665344, 16681728, 768, 768,
+  16699136, 16736000, 16771840, 16788224, 16804608, 16820992, 16837376, 16853760, 768, 16871168, 768, 16907008, 768, 16923392, 768, 16939776,
+  16957184, 17002240, 17047296, 17071872, 17096448, 17121024, 17145600, 17170176, 17194752, 17239808, 17284864, 17309440, 17334016, 17358592, 17383168, 17407744,
+  17432320, 17451520, 17464064, 17476096, 17489664, 17508864, 17521408, 17533440, 17545984, 17558016, 17570560, 17582592, 17596160, 17615360, 768, 768,
+  17627904, 17644288, 17660672, 17681152, 17701632, 17722112, 17742592, 17763072, 17783552, 17799936, 17816320, 17836800, 17857280, 17877760, 17898240, 17918720,
+  17939200, 17955584, 17971968, 17992448, 18012928, 18033408, 18053888, 18074368, 18094848, 18111232, 18127616, 18148096, 18168576, 18189056, 18209536, 18230016,
+  18250496, 18266880, 18283264, 18303744, 18324224, 18344704, 18365184, 18385664, 18406144, 18422528, 18438912, 18459392, 18479872, 18500352, 18520832, 18541312,
+  18561792, 18574080, 18586368, 18602752, 18615040, 768, 18632448, 18651904, 18668288, 18680576, 18692864, 18704896, 18717440, 32932608, 18729472, 18736896,
+  32944896, 18774784, 18799360, 18815744, 18828032, 768, 18845440, 18864896, 18881280, 18893312, 18905856, 18917888, 18930432, 18942720, 18967296, 18991872,
+  19016448, 19028736, 19041024, 19057152, 768, 768, 19073792, 19086080, 19102464, 19114752, 19127040, 19139072, 768, 19151616, 19176192, 19200768,
+  19225344, 19237632, 19249920, 19266048, 19282688, 19294976, 19307264, 19319552, 19335936, 19348224, 19360512, 19372544, 19385088, 19397376, 19421696, 19446272,
+  768, 768, 19454720, 19471104, 19483392, 768, 19500800, 19520256, 19536640, 19548672, 19561216, 19573248, 19585792, 19597824, 19613440, 768,
+  19651072, 19663360, 32957184, 32965376, 32973568, 32981760, 32989952, 32998144, 33006336, 33014528, 33022720, 768, 768, 768, 768, 768,
+  768, 33030912, 768, 768, 768, 768, 768, 33039104, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 33051392, 33059584, 33071872, 768, 768, 768, 768, 768, 768, 768, 768, 33088256,
+  768, 768, 768, 33096448, 33108736, 768, 33125120, 33137408, 768, 768, 768, 768, 33153792, 768, 33166080, 768,
+  768, 768, 768, 768, 768, 768, 768, 33178368, 33190656, 33202944, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 33215232, 768, 768, 768, 768, 768, 768, 768, 33235712,
+  33243904, 33252096, 768, 768, 33260288, 33268480, 33276672, 33284864, 33293056, 33301248, 33309440, 33317632, 33325824, 33334016, 33342208, 33350400,
+  33358592, 33366784, 33374976, 33383168, 33391360, 33399552, 33407744, 33415936, 33424128, 33432320, 33440512, 33448704, 33456896, 33465088, 33473280, 768,
+  33481472, 33489664, 33497856, 33506048, 33514240, 33522432, 33530624, 33538816, 33547008, 33555200, 33563392, 33571584, 33579776, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 33587968, 768, 768, 768, 768, 768, 768, 768,
+  486, 486, 257, 257, 486, 486, 486, 486, 257, 257, 257, 486, 486, 768, 768, 768,
+  768, 486, 768, 768, 768, 257, 257, 486, 476, 486, 257, 257, 476, 476, 476, 476,
+  486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  33600256, 33616640, 33633024, 33641216, 768, 33653504, 33669888, 33686272, 768, 33694464, 33706752, 33714944, 33723136, 33731328, 33739520, 33747712,
+  33755904, 33764096, 33772288, 33780480, 768, 33788672, 33796864, 768, 768, 33809152, 33817344, 33825536, 33833728, 33841920, 768, 768,
+  33850112, 33862400, 33878784, 768, 33891072, 768, 19675648, 768, 33899264, 768, 19683840, 19692032, 33907456, 33915648, 768, 33923840,
+  33932032, 33940224, 768, 33948416, 33956608, 33964800, 33972992, 33981184, 33989376, 33997568, 768, 34005760, 34022144, 34030336, 34038528, 34046720,
+  34054912, 768, 768, 768, 768, 34063104, 34071296, 34079488, 34087680, 34095872, 768, 768, 768, 768, 768, 768,
+  34104064, 34120448, 34136832, 34157312, 34173696, 34190080, 34206464, 34222848, 34239232, 34255616, 34272000, 34288384, 34304768, 34321152, 34337536, 34353920,
+  34366208, 34374400, 34386688, 34403072, 34415360, 34423552, 34435840, 34452224, 34472704, 34484992, 34493184, 34505472, 34521856, 34530048, 34538240, 34546432,
+  34554624, 34562816, 34575104, 34591488, 34603776, 34611968, 34624256, 34640640, 34661120, 34673408, 34681600, 34693888, 34710272, 34718464, 34726656, 34734848,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 34743040, 768, 768, 768, 768, 768, 768,
+  19703552, 768, 19715840, 768, 19728128, 768, 768, 768, 768, 768, 19741440, 19753728, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 19766016, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 19778304, 19790592, 19802880,
+  19814144, 768, 19826432, 768, 19838720, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 19851008, 19864320, 768, 768, 768, 19875584, 19888896, 768, 19900160, 19913472, 768, 768, 768,
+  768, 768, 768, 19924736, 19938048, 19949312, 19962624, 768, 768, 768, 768, 768, 34759424, 34771712, 768, 34788096,
+  34800384, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 19973888, 768, 768, 768,
+  768, 19987200, 768, 19998464, 20011776, 20023040, 768, 20036352, 20047616, 20060928, 768, 768, 768, 20072192, 768, 768,
+  20085504, 20096768, 20110080, 768, 20121344, 20133632, 768, 768, 768, 768, 768, 768, 768, 20146944, 20159232, 20171520,
+  20183808, 20196096, 20207360, 20219648, 20232960, 20245248, 20256512, 20268800, 20282112, 20294400, 20305664, 20317952, 20330240, 20342528, 768, 768,
+  20355840, 20368128, 20379392, 20391680, 20404992, 20417280, 20428544, 20440832, 20454144, 20466432, 768, 768, 768, 768, 768, 768,
+  768, 20477696, 20489984, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 20502272, 768, 768, 768, 768, 768, 20514560, 20526848, 768, 20539136, 20552448, 20564736, 20577024, 20589312,
+  768, 768, 20600576, 20612864, 20625152, 20637440, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  20650752, 20663040, 20675328, 20687616, 768, 768, 768, 768, 768, 768, 20699904, 20712192, 20724480, 20736768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 20748800, 20756992, 768, 768, 768, 768, 768,
+  34816768, 34824960, 34833152, 34841344, 34849536, 34857728, 34865920, 34874112, 34882304, 34890496, 34902784, 34915072, 34927360, 34939648, 34951936, 34964224,
+  34976512, 34988800, 35001088, 35013376, 35025664, 35042048, 35058432, 35074816, 35091200, 35107584, 35123968, 35140352, 35156736, 35173120, 35193600, 35214080,
+  35234560, 35255040, 35275520, 35296000, 35316480, 35336960, 35357440, 35377920, 35398400, 35410688, 35422976, 35435264, 35447552, 35459840, 35472128, 35484416,
+  35496704, 35508992, 35525376, 35541760, 35558144, 35574528, 35590912, 35607296, 35623680, 35640064, 35656448, 35672832, 35689216, 35705600, 35721984, 35738368,
+  35754752, 35771136, 35787520, 35803904, 35820288, 35836672, 35853056, 35869440, 35885824, 35902208, 35918592, 35934976, 35951360, 35967744, 35984128, 36000512,
+  36016896, 36033280, 36049664, 36066048, 36082432, 36098816, 36115200, 36123392, 36131584, 36139776, 36147968, 36156160, 36164352, 36172544, 36180736, 36188928,
+  36197120, 36205312, 36213504, 36221696, 36229888, 36238080, 36246272, 36254464, 36262656, 36270848, 36279040, 36287232, 36295424, 36303616, 36311808, 36320000,
+  36328192, 36336384, 36344576, 36352768, 36360960, 36369152, 36377344, 36385536, 36393728, 36401920, 36410112, 36418304, 36426496, 36434688, 36442880, 36451072,
+  36459264, 36467456, 36475648, 36483840, 36492032, 36500224, 36508416, 36516608, 36524800, 36532992, 36541184, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 36549376, 768, 768, 768,
+  768, 768, 768, 768, 36569856, 36586240, 36598528, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 20765184, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 36614912, 36623104, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486,
+  486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 36631296,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 36639488,
+  768, 768, 768, 36647680, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  36655872, 36664064, 36672256, 36680448, 36688640, 36696832, 36705024, 36713216, 36721408, 36729600, 36737792, 36745984, 36754176, 36762368, 36770560, 36778752,
+  36786944, 36795136, 36803328, 36811520, 36819712, 36827904, 36836096, 36844288, 36852480, 36860672, 36868864, 36877056, 36885248, 36893440, 36901632, 36909824,
+  36918016, 36926208, 36934400, 36942592, 36950784, 36958976, 36967168, 36975360, 36983552, 36991744, 36999936, 37008128, 37016320, 37024512, 37032704, 37040896,
+  37049088, 37057280, 37065472, 37073664, 37081856, 37090048, 37098240, 37106432, 37114624, 37122816, 37131008, 37139200, 37147392, 37155584, 37163776, 37171968,
+  37180160, 37188352, 37196544, 37204736, 37212928, 37221120, 37229312, 37237504, 37245696, 37253888, 37262080, 37270272, 37278464, 37286656, 37294848, 37303040,
+  37311232, 37319424, 37327616, 37335808, 37344000, 37352192, 37360384, 37368576, 37376768, 37384960, 37393152, 37401344, 37409536, 37417728, 37425920, 37434112,
+  37442304, 37450496, 37458688, 37466880, 37475072, 37483264, 37491456, 37499648, 37507840, 37516032, 37524224, 37532416, 37540608, 37548800, 37556992, 37565184,
+  37573376, 37581568, 37589760, 37597952, 37606144, 37614336, 37622528, 37630720, 37638912, 37647104, 37655296, 37663488, 37671680, 37679872, 37688064, 37696256,
+  37704448, 37712640, 37720832, 37729024, 37737216, 37745408, 37753600, 37761792, 37769984, 37778176, 37786368, 37794560, 37802752, 37810944, 37819136, 37827328,
+  37835520, 37843712, 37851904, 37860096, 37868288, 37876480, 37884672, 37892864, 37901056, 37909248, 37917440, 37925632, 37933824, 37942016, 37950208, 37958400,
+  37966592, 37974784, 37982976, 37991168, 37999360, 38007552, 38015744, 38023936, 38032128, 38040320, 38048512, 38056704, 38064896, 38073088, 38081280, 38089472,
+  38097664, 38105856, 38114048, 38122240, 38130432, 38138624, 38146816, 38155008, 38163200, 38171392, 38179584, 38187776, 38195968, 38204160, 38212352, 38220544,
+  38228736, 38236928, 38245120, 38253312, 38261504, 38269696, 38277888, 38286080, 38294272, 38302464, 38310656, 38318848, 38327040, 38335232, 38343424, 38351616,
+  38359808, 38368000, 38376192, 38384384, 38392576, 38400768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  38408960, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 474, 484, 488, 478, 480, 480,
+  768, 768, 768, 768, 768, 768, 38417152, 768, 38425344, 38433536, 38441728, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 20776704, 768, 768, 768, 768, 20788992, 20802304, 20813568, 20826880, 20838144,
+  20851456, 20862720, 20876032, 20887296, 20900608, 20911872, 20925184, 20936448, 20949760, 20961024, 20974336, 20985600, 20998912, 21010176, 21023488, 21034752,
+  21048064, 21059328, 21072640, 768, 21083904, 21097216, 21108480, 21121792, 21133056, 21146368, 768, 768, 768, 768, 768, 21157632,
+  21179136, 21191424, 21202688, 21224192, 21236480, 21247744, 21269248, 21281536, 21292800, 21314304, 21326592, 21337856, 21359360, 21371648, 768, 768,
+  768, 768, 768, 768, 21383936, 768, 768, 768, 768, 8, 8, 38449920, 38462208, 21395200, 21408512, 38474496,
+  768, 768, 768, 768, 768, 768, 21419776, 768, 768, 768, 768, 21432064, 21445376, 21456640, 21469952, 21481216,
+  21494528, 21505792, 21519104, 21530368, 21543680, 21554944, 21568256, 21579520, 21592832, 21604096, 21617408, 21628672, 21641984, 21653248, 21666560, 21677824,
+  21691136, 21702400, 21715712, 768, 21726976, 21740288, 21751552, 21764864, 21776128, 21789440, 768, 768, 768, 768, 768, 21800704,
+  21822208, 21834496, 21845760, 21867264, 21879552, 21890816, 21912320, 21924608, 21935872, 21957376, 21969664, 21980928, 22002432, 22014720, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 22025984,
+  22038272, 22050560, 22062848, 768, 22076160, 768, 768, 22088448, 22100736, 22113024, 22125312, 768, 768, 22136576, 22149888, 38486784,
+  768, 38499072, 38507264, 38515456, 38523648, 38531840, 38540032, 38548224, 38556416, 38564608, 38572800, 38580992, 38589184, 38597376, 38605568, 38613760,
+  38621952, 38630144, 38638336, 38646528, 38654720, 38662912, 38671104, 38679296, 38687488, 38695680, 38703872, 38712064, 38720256, 38728448, 38736640, 38744832,
+  38753024, 38761216, 38769408, 38777600, 38785792, 38793984, 38802176, 38810368, 38818560, 38826752, 38834944, 38843136, 38851328, 38859520, 38867712, 38875904,
+  38884096, 38892288, 38900480, 38908672, 38916864, 38925056, 38933248, 38941440, 38949632, 38957824, 38966016, 38974208, 38982400, 38990592, 38998784, 39006976,
+  39015168, 39023360, 39031552, 39039744, 39047936, 39056128, 39064320, 39072512, 39080704, 39088896, 39097088, 39105280, 39113472, 39121664, 39129856, 39138048,
+  39146240, 39154432, 39162624, 39170816, 39179008, 39187200, 39195392, 39203584, 39211776, 39219968, 39228160, 39236352, 39244544, 39252736, 39260928, 768,
+  768, 768, 39269120, 39277312, 39285504, 39293696, 39301888, 39310080, 39318272, 39326464, 39334656, 39342848, 39351040, 39359232, 39367424, 39375616,
+  39383808, 39400192, 39416576, 39432960, 39449344, 39465728, 39482112, 39498496, 39514880, 39531264, 39547648, 39564032, 39580416, 39596800, 39613184, 39633664,
+  39654144, 39674624, 39695104, 39715584, 39736064, 39756544, 39777024, 39797504, 39817984, 39838464, 39858944, 39879424, 39899904, 39920384, 39953152, 768,
+  39981824, 39998208, 40014592, 40030976, 40047360, 40063744, 40080128, 40096512, 40112896, 40129280, 40145664, 40162048, 40178432, 40194816, 40211200, 40227584,
+  40243968, 40260352, 40276736, 40293120, 40309504, 40325888, 40342272, 40358656, 40375040, 40391424, 40407808, 40424192, 40440576, 40456960, 40473344, 40489728,
+  40506112, 40522496, 40538880, 40555264, 40571648, 40579840, 40588032, 40596224, 768, 768, 768, 768, 768, 768, 768, 768,
+  40604416, 40620800, 40633088, 40645376, 40657664, 40669952, 40682240, 40694528, 40706816, 40719104, 40731392, 40743680, 40755968, 40768256, 40780544, 40792832,
+  40805120, 40813312, 40821504, 40829696, 40837888, 40846080, 40854272, 40862464, 40870656, 40878848, 40887040, 40895232, 40903424, 40911616, 40919808, 40932096,
+  40944384, 40956672, 40968960, 40981248, 40993536, 41005824, 41018112, 41030400, 41042688, 41054976, 41067264, 41079552, 41091840, 41116416, 41136896, 768,
+  41149184, 41157376, 41165568, 41173760, 41181952, 41190144, 41198336, 41206528, 41214720, 41222912, 41231104, 41239296, 41247488, 41255680, 41263872, 41272064,
+  41280256, 41288448, 41296640, 41304832, 41313024, 41321216, 41329408, 41337600, 41345792, 41353984, 41362176, 41370368, 41378560, 41386752, 41394944, 41403136,
+  41411328, 41419520, 41427712, 41435904, 41444096, 41452288, 41460480, 41468672, 41476864, 41485056, 41493248, 41501440, 41509632, 41517824, 41526016, 41534208,
+  41542400, 41550592, 41562880, 41575168, 41587456, 41599744, 41612032, 41624320, 41636608, 41648896, 41661184, 41673472, 41685760, 41698048, 41710336, 41722624,
+  41734912, 41747200, 41759488, 41771776, 41784064, 41796352, 41808640, 41820928, 41833216, 41845504, 41861888, 41878272, 41894656, 41906944, 41923328, 41935616,
+  41952000, 41960192, 41968384, 41976576, 41984768, 41992960, 42001152, 42009344, 42017536, 42025728, 42033920, 42042112, 42050304, 42058496, 42066688, 42074880,
+  42083072, 42091264, 42099456, 42107648, 42115840, 42124032, 42132224, 42140416, 42148608, 42156800, 42164992, 42173184, 42181376, 42189568, 42197760, 42205952,
+  42214144, 42222336, 42230528, 42238720, 42246912, 42255104, 42263296, 42271488, 42279680, 42287872, 42296064, 42304256, 42312448, 42320640, 42328832, 42337024,
+  42349312, 42373888, 42394368, 42418944, 42435328, 42459904, 42476288, 42492672, 42521344, 42541824, 42558208, 42574592, 42590976, 42611456, 42631936, 42652416,
+  42672896, 42693376, 42713856, 42734336, 42763008, 42775296, 42803968, 42832640, 42857216, 42877696, 42906368, 42935040, 42955520, 42971904, 42988288, 43008768,
+  43029248, 43053824, 43078400, 43094784, 43111168, 43131648, 43148032, 43164416, 43176704, 43188992, 43205376, 43221760, 43250432, 43270912, 43295488, 43324160,
+  43344640, 43361024, 43377408, 43406080, 43426560, 43455232, 43471616, 43496192, 43512576, 43533056, 43549440, 43569920, 43594496, 43614976, 43639552, 43660032,
+  43672320, 43696896, 43713280, 43729664, 43750144, 43766528, 43782912, 43799296, 43823872, 43844352, 43856640, 43885312, 43901696, 43926272, 43946752, 43967232,
+  43983616, 44000000, 44020480, 44032768, 44053248, 44077824, 44090112, 44118784, 44135168, 44147456, 44159744, 44172032, 44184320, 44196608, 44208896, 44221184,
+  44233472, 44245760, 44258048, 44274432, 44290816, 44307200, 44323584, 44339968, 44356352, 44372736, 44389120, 44405504, 44421888, 44438272, 44454656, 44471040,
+  44487424, 44503808, 44520192, 44532480, 44544768, 44561152, 44573440, 44585728, 44598016, 44614400, 44630784, 44643072, 44655360, 44667648, 44679936, 44692224,
+  44712704, 44724992, 44737280, 44749568, 44761856, 44774144, 44786432, 44798720, 44811008, 44827392, 44847872, 44860160, 44872448, 44884736, 44897024, 44909312,
+  44921600, 44933888, 44950272, 44966656, 44983040, 44999424, 45011712, 45024000, 45036288, 45048576, 45060864, 45073152, 45085440, 45097728, 45110016, 45122304,
+  45138688, 45155072, 45167360, 45183744, 45200128, 45216512, 45228800, 45245184, 45261568, 45282048, 45294336, 45310720, 45327104, 45343488, 45359872, 45384448,
+  45413120, 45425408, 45437696, 45449984, 45462272, 45474560, 45486848, 45499136, 45511424, 45523712, 45536000, 45548288, 45560576, 45572864, 45585152, 45597440,
+  45609728, 45622016, 45634304, 45654784, 45667072, 45679360, 45691648, 45712128, 45728512, 45740800, 45753088, 45765376, 45777664, 45789952, 45802240, 45814528,
+  45826816, 45839104, 45851392, 45867776, 45880064, 45892352, 45908736, 45925120, 45937408, 45957888, 45974272, 45986560, 45998848, 46011136, 46023424, 46039808,
+  46056192, 46068480, 46080768, 46093056, 46105344, 46117632, 46129920, 46142208, 46154496, 46166784, 46183168, 46199552, 46215936, 46232320, 46248704, 46265088,
+  46281472, 46297856, 46314240, 46330624, 46347008, 46363392, 46379776, 46396160, 46412544, 46428928, 46445312, 46461696, 46478080, 46494464, 46510848, 46527232,
+  768, 768, 768, 768, 486, 486, 486, 486, 486, 486, 486, 486, 486, 486, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 46543616, 46551808, 486, 486,
+  46560000, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 46568192, 46576384, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 476, 476, 476, 768, 768,
+  768, 768, 768, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 263, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  486, 768, 486, 486, 476, 768, 768, 486, 486, 768, 768, 768, 768, 768, 486, 486,
+  768, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 46584576, 46592768, 46600960, 46609152,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 46617344, 768, 768, 768, 768, 768, 768,
+  22161920, 22170112, 22178304, 22186496, 22194688, 22202880, 22211072, 22219264, 22227456, 22235648, 22243840, 22252032, 22260224, 22268416, 22276608, 22284800,
+  22292992, 22301184, 22309376, 22317568, 22325760, 22333952, 22342144, 22350336, 22358528, 22366720, 22374912, 22383104, 22391296, 22399488, 22407680, 22415872,
+  22424064, 22432256, 22440448, 22448640, 22456832, 22465024, 22473216, 22481408, 22489600, 22497792, 22505984, 22514176, 22522368, 22530560, 22538752, 22546944,
+  22555136, 22563328, 22571520, 22579712, 22587904, 22596096, 22604288, 22612480, 22620672, 22628864, 22637056, 22645248, 22653440, 22661632, 22669824, 22678016,
+  22686208, 22694400, 22702592, 22710784, 22718976, 22727168, 22735360, 22743552, 22751744, 22759936, 22768128, 22776320, 22784512, 22792704, 22800896, 22809088,
+  22817280, 22825472, 22833664, 22841856, 22850048, 22858240, 22866432, 22874624, 22882816, 22891008, 22899200, 22907392, 22915584, 22923776, 22931968, 22940160,
+  22948352, 22956544, 22964736, 22972928, 22981120, 22989312, 22997504, 23005696, 23013888, 23022080, 23030272, 23038464, 23046656, 23054848, 23063040, 23071232,
+  23079424, 23087616, 23095808, 23104000, 23112192, 23120384, 23128576, 23136768, 23144960, 23153152, 23161344, 23169536, 23177728, 23185920, 23194112, 23202304,
+  23210496, 23218688, 23226880, 23235072, 23243264, 23251456, 23259648, 23267840, 23276032, 23284224, 23292416, 23300608, 23308800, 23316992, 23325184, 23333376,
+  23341568, 23349760, 23357952, 23366144, 23374336, 23382528, 23390720, 23398912, 23407104, 23415296, 23423488, 23431680, 23439872, 23448064, 23456256, 23464448,
+  23472640, 23480832, 23489024, 23497216, 23505408, 23513600, 23521792, 23529984, 23538176, 23546368, 23554560, 23562752, 23570944, 23579136, 23587328, 23595520,
+  23603712, 23611904, 23620096, 23628288, 23636480, 23644672, 23652864, 23661056, 23669248, 23677440, 23685632, 23693824, 23702016, 23710208, 23718400, 23726592,
+  23734784, 23742976, 23751168, 23759360, 23767552, 23775744, 23783936, 23792128, 23800320, 23808512, 23816704, 23824896, 23833088, 23841280, 23849472, 23857664,
+  23865856, 23874048, 23882240, 23890432, 23898624, 23906816, 23915008, 23923200, 23931392, 23939584, 23947776, 23955968, 23964160, 23972352, 23980544, 23988736,
+  23996928, 24005120, 24013312, 24021504, 24029696, 24037888, 24046080, 24054272, 24062464, 24070656, 24078848, 24087040, 24095232, 24103424, 24111616, 24119808,
+  24128000, 24136192, 24144384, 24152576, 24160768, 24168960, 24177152, 24185344, 24193536, 24201728, 24209920, 24218112, 24226304, 24234496, 24242688, 24250880,
+  24259072, 24267264, 24275456, 24283648, 24291840, 24300032, 24308224, 24316416, 24324608, 24332800, 24340992, 24349184, 24357376, 24365568, 768, 768,
+  24373760, 768, 24381952, 768, 768, 24390144, 24398336, 24406528, 24414720, 24422912, 24431104, 24439296, 24447488, 24455680, 24463872, 768,
+  24472064, 768, 24480256, 768, 768, 24488448, 24496640, 768, 768, 768, 24504832, 24513024, 24521216, 24529408, 24537600, 24545792,
+  24553984, 24562176, 24570368, 24578560, 24586752, 24594944, 24603136, 24611328, 24619520, 24627712, 24635904, 24644096, 24652288, 24660480, 24668672, 24676864,
+  24685056, 24693248, 24701440, 24709632, 24717824, 24726016, 24734208, 24742400, 24750592, 24758784, 24766976, 24775168, 24783360, 24791552, 24799744, 24807936,
+  24816128, 24824320, 24832512, 24840704, 24848896, 24857088, 24865280, 24873472, 24881664, 24889856, 24898048, 24906240, 24914432, 24922624, 24930816, 24939008,
+  24947200, 24955392, 24963584, 24971776, 24979968, 24988160, 24996352, 25004544, 25012736, 25020928, 25029120, 25037312, 25045504, 25053696, 768, 768,
+  25061888, 25070080, 25078272, 25086464, 25094656, 25102848, 25111040, 25119232, 25127424, 25135616, 25143808, 25152000, 25160192, 25168384, 25176576, 25184768,
+  25192960, 25201152, 25209344, 25217536, 25225728, 25233920, 25242112, 25250304, 25258496, 25266688, 25274880, 25283072, 25291264, 25299456, 25307648, 25315840,
+  25324032, 25332224, 25340416, 25348608, 25356800, 25364992, 25373184, 25381376, 25389568, 25397760, 25405952, 25414144, 25422336, 25430528, 25438720, 25446912,
+  25455104, 25463296, 25471488, 25479680, 25487872, 25496064, 25504256, 25512448, 25520640, 25528832, 25537024, 25545216, 25553408, 25561600, 25569792, 25577984,
+  25586176, 25594368, 25602560, 25610752, 25618944, 25627136, 25635328, 25643520, 25651712, 25659904, 25668096, 25676288, 25684480, 25692672, 25700864, 25709056,
+  25717248, 25725440, 25733632, 25741824, 25750016, 25758208, 25766400, 25774592, 25782784, 25790976, 25799168, 25807360, 25815552, 25823744, 25831936, 25840128,
+  25848320, 25856512, 25864704, 25872896, 25881088, 25889280, 25897472, 25905664, 25913856, 25922048, 768, 768, 768, 768, 768, 768,
+  46625536, 46637824, 46650112, 46662400, 46678784, 46695168, 46707456, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 46719744, 46732032, 46744320, 46756608, 46768896, 768, 768, 768, 768, 768, 25930240, 282, 25942528,
+  46781184, 46789376, 46797568, 46805760, 46813952, 46822144, 46830336, 46838528, 46846720, 46854912, 25954816, 25967104, 25979392, 25995776, 26012160, 26024448,
+  26036736, 26049024, 26061312, 26073600, 26085888, 26098176, 26110464, 768, 26122752, 26135040, 26147328, 26159616, 26171904, 768, 26184192, 768,
+  26196480, 26208768, 768, 26221056, 26233344, 768, 26245632, 26257920, 26270208, 26282496, 26294784, 26307072, 26319360, 26331648, 26343936, 46863104,
+  46875392, 46883584, 46891776, 46899968, 46908160, 46916352, 46924544, 46932736, 46940928, 46949120, 46957312, 46965504, 46973696, 46981888, 46990080, 46998272,
+  47006464, 47014656, 47022848, 47031040, 47039232, 47047424, 47055616, 47063808, 47072000, 47080192, 47088384, 47096576, 47104768, 47112960, 47121152, 47129344,
+  47137536, 47145728, 47153920, 47162112, 47170304, 47178496, 47186688, 47194880, 47203072, 47211264, 47219456, 47227648, 47235840, 47244032, 47252224, 47260416,
+  47268608, 47276800, 47284992, 47293184, 47301376, 47309568, 47317760, 47325952, 47334144, 47342336, 47350528, 47358720, 47366912, 47375104, 47383296, 47391488,
+  47399680, 47407872, 47416064, 47424256, 47432448, 47440640, 47448832, 47457024, 47465216, 47473408, 47481600, 47489792, 47497984, 47506176, 47514368, 47522560,
+  47530752, 47538944, 47547136, 47555328, 47563520, 47575808, 47588096, 47596288, 47604480, 47612672, 47620864, 47629056, 47637248, 47645440, 47653632, 47661824,
+  47670016, 47682304, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 47694592, 47702784, 47710976, 47719168, 47727360, 47735552, 47743744, 47751936, 47760128, 47768320, 47776512, 47788800, 47796992,
+  47805184, 47813376, 47821568, 47829760, 47837952, 47846144, 47854336, 47862528, 47870720, 47878912, 47887104, 47903488, 47919872, 47936256, 47952640, 47969024,
+  47985408, 48001792, 48018176, 48034560, 48050944, 48067328, 48083712, 48100096, 48116480, 48132864, 48149248, 48165632, 48182016, 48190208, 48198400, 48206592,
+  48214784, 48231168, 48247552, 48263936, 48280320, 48296704, 48308992, 48321280, 48333568, 48345856, 48358144, 48370432, 48382720, 48395008, 48407296, 48419584,
+  48431872, 48444160, 48456448, 48468736, 48481024, 48493312, 48505600, 48517888, 48530176, 48542464, 48554752, 48567040, 48579328, 48591616, 48603904, 48616192,
+  48628480, 48640768, 48653056, 48665344, 48677632, 48689920, 48702208, 48714496, 48726784, 48739072, 48751360, 48763648, 48775936, 48788224, 48800512, 48812800,
+  48825088, 48837376, 48849664, 48861952, 48874240, 48886528, 48898816, 48911104, 48923392, 48935680, 48947968, 48960256, 48972544, 48984832, 48997120, 49009408,
+  49021696, 49033984, 49046272, 49058560, 49070848, 49083136, 49095424, 49107712, 49120000, 49132288, 49144576, 49156864, 49169152, 49181440, 49193728, 49206016,
+  49218304, 49230592, 49242880, 49255168, 49267456, 49279744, 49292032, 49304320, 49316608, 49328896, 49341184, 49353472, 49365760, 49378048, 49390336, 49406720,
+  49423104, 49439488, 49455872, 49472256, 49488640, 49505024, 49521408, 49537792, 49554176, 49570560, 49586944, 49599232, 49611520, 49623808, 49636096, 49648384,
+  49660672, 49672960, 49685248, 49697536, 49709824, 49722112, 49734400, 49746688, 49758976, 49771264, 49783552, 49795840, 49808128, 49820416, 49832704, 49844992,
+  49857280, 49869568, 49881856, 49894144, 49906432, 49918720, 49931008, 49943296, 49955584, 49967872, 49980160, 49992448, 50004736, 50017024, 50029312, 50041600,
+  50053888, 50066176, 50078464, 50090752, 50103040, 50115328, 50127616, 50139904, 50156288, 50172672, 50189056, 50205440, 50221824, 50234112, 50246400, 50258688,
+  50270976, 50283264, 50295552, 50307840, 50320128, 50332416, 50344704, 50356992, 50369280, 50381568, 50393856, 50406144, 50418432, 50430720, 50443008, 50455296,
+  50467584, 50479872, 50492160, 50504448, 50516736, 50529024, 50541312, 50553600, 50565888, 50578176, 50590464, 50602752, 50615040, 50627328, 50639616, 50651904,
+  50664192, 50676480, 50688768, 50701056, 50713344, 50725632, 50737920, 50750208, 50762496, 50774784, 50787072, 50799360, 50811648, 50823936, 50836224, 50848512,
+  50860800, 50873088, 50885376, 50897664, 50909952, 50922240, 50934528, 50946816, 50959104, 50971392, 50983680, 50995968, 51008256, 51020544, 51032832, 51045120,
+  51061504, 51077888, 51090176, 51102464, 51114752, 51127040, 51139328, 51151616, 51163904, 51176192, 51188480, 51200768, 51213056, 51225344, 51237632, 51249920,
+  51262208, 51274496, 51286784, 51303168, 51319552, 51335936, 51348224, 51360512, 51372800, 51385088, 51397376, 51409664, 51421952, 51434240, 51446528, 51458816,
+  51471104, 51483392, 51495680, 51507968, 51520256, 51532544, 51544832, 51557120, 51569408, 51581696, 51593984, 51606272, 51618560, 51630848, 51643136, 51655424,
+  51667712, 51680000, 51692288, 51704576, 51716864, 51729152, 51741440, 51753728, 51766016, 51778304, 51790592, 51802880, 51815168, 51827456, 51839744, 51852032,
+  51864320, 51876608, 51888896, 51901184, 51913472, 51925760, 51938048, 51950336, 51962624, 51974912, 51987200, 51999488, 52011776, 52024064, 52036352, 52048640,
+  52060928, 52073216, 52085504, 52097792, 52110080, 52122368, 52134656, 52146944, 52159232, 52171520, 52183808, 52196096, 52208384, 52220672, 768, 768,
+  52232960, 52249344, 52265728, 52282112, 52298496, 52314880, 52331264, 52347648, 52364032, 52380416, 52396800, 52413184, 52429568, 52445952, 52462336, 52478720,
+  52495104, 52511488, 52527872, 52544256, 52560640, 52577024, 52593408, 52609792, 52626176, 52642560, 52658944, 52675328, 52691712, 52708096, 52724480, 52740864,
+  52757248, 52773632, 52790016, 52806400, 52822784, 52839168, 52855552, 52871936, 52888320, 52904704, 52921088, 52937472, 52953856, 52970240, 52986624, 53003008,
+  53019392, 53035776, 53052160, 53068544, 53084928, 53101312, 53117696, 53134080, 53150464, 53166848, 53183232, 53199616, 53216000, 53232384, 53248768, 53265152,
+  768, 768, 53281536, 53297920, 53314304, 53330688, 53347072, 53363456, 53379840, 53396224, 53412608, 53428992, 53445376, 53461760, 53478144, 53494528,
+  53510912, 53527296, 53543680, 53560064, 53576448, 53592832, 53609216, 53625600, 53641984, 53658368, 53674752, 53691136, 53707520, 53723904, 53740288, 53756672,
+  53773056, 53789440, 53805824, 53822208, 53838592, 53854976, 53871360, 53887744, 53904128, 53920512, 53936896, 53953280, 53969664, 53986048, 54002432, 54018816,
+  54035200, 54051584, 54067968, 54084352, 54100736, 54117120, 54133504, 54149888, 768, 768, 768, 768, 768, 768, 768, 768,
+  54166272, 54182656, 54199040, 54219520, 54240000, 54260480, 54280960, 54301440, 54321920, 54342400, 54358784, 54436608, 54473472, 768, 768, 768,
+  54493952, 54502144, 54510336, 54518528, 54526720, 54534912, 54543104, 54551296, 54559488, 54567680, 768, 768, 768, 768, 768, 768,
+  486, 486, 486, 486, 486, 486, 486, 476, 476, 476, 476, 476, 476, 476, 486, 486,
+  54584064, 54596352, 54604544, 54612736, 54620928, 54629120, 54637312, 54645504, 54653696, 54661888, 54670080, 54678272, 54686464, 54694656, 54702848, 54711040,
+  54719232, 54727424, 54735616, 54743808, 54752000, 768, 768, 54760192, 54768384, 54776576, 54788864, 54801152, 54813440, 54825728, 54833920, 54842112,
+  54850304, 54858496, 54866688, 768, 54874880, 54883072, 54891264, 54899456, 54907648, 54915840, 54924032, 54932224, 54940416, 54948608, 54956800, 54964992,
+  54973184, 54981376, 54989568, 54997760, 55005952, 55014144, 55022336, 768, 55030528, 55038720, 55046912, 55055104, 768, 768, 768, 768,
+  55063296, 55075584, 55087872, 768, 55100160, 768, 55112448, 55124736, 55137024, 55149312, 55161600, 55173888, 55186176, 55198464, 55210752, 55223040,
+  55235328, 55243520, 55255808, 55268096, 55280384, 55292672, 55304960, 55317248, 55329536, 55341824, 55354112, 55366400, 55378688, 55390976, 55399168, 55407360,
+  55415552, 55423744, 55431936, 55440128, 55448320, 55456512, 55464704, 55472896, 55481088, 55489280, 55497472, 55505664, 55513856, 55522048, 55530240, 55538432,
+  55546624, 55554816, 55563008, 55571200, 55579392, 55587584, 55595776, 55603968, 55612160, 55620352, 55628544, 55636736, 55644928, 55653120, 55661312, 55669504,
+  55677696, 55685888, 55694080, 55702272, 55710464, 55718656, 55726848, 55735040, 55743232, 55751424, 55759616, 55767808, 55776000, 55784192, 55792384, 55800576,
+  55808768, 55816960, 55825152, 55833344, 55841536, 55849728, 55857920, 55866112, 55874304, 55882496, 55890688, 55898880, 55907072, 55915264, 55923456, 55931648,
+  55939840, 55948032, 55956224, 55964416, 55972608, 55980800, 55988992, 55997184, 56005376, 56013568, 56021760, 56029952, 56038144, 56046336, 56054528, 56062720,
+  56070912, 56079104, 56087296, 56095488, 56103680, 56111872, 56120064, 56128256, 56136448, 56144640, 56152832, 56161024, 56169216, 56177408, 56185600, 56193792,
+  56201984, 56210176, 56218368, 56226560, 56234752, 56242944, 56259328, 56275712, 56292096, 56308480, 56324864, 56341248, 56353536, 768, 768, 768,
+  768, 56365824, 56374016, 56382208, 56390400, 56398592, 56406784, 56414976, 56423168, 56431360, 56439552, 56447744, 56455936, 56464128, 56472320, 56480512,
+  56488704, 56496896, 56505088, 56513280, 56521472, 56529664, 56537856, 56546048, 56554240, 56562432, 56570624, 56578816, 56587008, 56595200, 56603392, 56611584,
+  56619776, 56627968, 56636160, 56644352, 56652544, 56660736, 56668928, 56677120, 56685312, 56693504, 56701696, 56709888, 56718080, 56726272, 56734464, 56742656,
+  56750848, 56759040, 56767232, 56775424, 56783616, 56791808, 56800000, 56808192, 56816384, 56824576, 56832768, 56840960, 56849152, 56857344, 56865536, 56873728,
+  56881920, 56890112, 56898304, 56906496, 56914688, 56922880, 56931072, 56939264, 56947456, 56955648, 56963840, 56972032, 56980224, 56988416, 56996608, 57004800,
+  57012992, 57021184, 57029376, 57037568, 57045760, 57053952, 57062144, 57070336, 57078528, 57086720, 57094912, 57103104, 57111296, 57119488, 57127680, 57135872,
+  57144064, 57152256, 57160448, 57168640, 57176832, 57185024, 57193216, 57201408, 57209600, 57217792, 57225984, 57234176, 57242368, 57250560, 57258752, 57266944,
+  57275136, 57283328, 57291520, 57299712, 57307904, 57316096, 57324288, 57332480, 57340672, 57348864, 57357056, 57365248, 57373440, 57381632, 57389824, 57398016,
+  57406208, 57414400, 57422592, 57430784, 57438976, 57447168, 57455360, 57463552, 57471744, 57479936, 57488128, 57496320, 57504512, 57512704, 57520896, 57529088,
+  57537280, 57545472, 57553664, 57561856, 57570048, 57578240, 57586432, 57594624, 57602816, 57611008, 57619200, 57627392, 57635584, 57643776, 57651968, 57660160,
+  57668352, 57676544, 57684736, 57692928, 57701120, 57709312, 57717504, 57725696, 57733888, 57742080, 57750272, 57758464, 57766656, 57774848, 57783040, 57791232,
+  57799424, 57807616, 57815808, 57824000, 57832192, 57840384, 57848576, 57856768, 57864960, 57873152, 57881344, 57889536, 57897728, 57905920, 57914112, 768,
+  768, 768, 57922304, 57930496, 57938688, 57946880, 57955072, 57963264, 768, 768, 57971456, 57979648, 57987840, 57996032, 58004224, 58012416,
+  768, 768, 58020608, 58028800, 58036992, 58045184, 58053376, 58061568, 768, 768, 58069760, 58077952, 58086144, 768, 768, 768,
+  58094336, 58102528, 58110720, 58118912, 58131200, 58139392, 58147584, 768, 58155776, 58163968, 58172160, 58180352, 58188544, 58196736, 58204928, 768,
+  768, 768, 768, 768, 768, 768, 486, 486, 486, 486, 486, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 476, 768, 486,
+  768, 768, 768, 768, 768, 768, 768, 768, 486, 257, 476, 768, 768, 768, 768, 265,
+  768, 768, 768, 768, 768, 486, 476, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 486, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 486, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 476, 476, 486, 486, 486, 476, 486, 476, 476, 476,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 26355456, 26368768, 26380032, 26393344, 768, 768, 768,
+  768, 768, 768, 768, 768, 26404608, 768, 768, 768, 768, 768, 26417920, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 7, 768, 768, 768, 768, 768,
+  486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 0, 768, 768, 768, 768, 768, 768, 26430208, 26442496,
+  768, 26453760, 26466048, 265, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 265, 263, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 265, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 263, 263, 768, 0, 768,
+  768, 768, 768, 768, 768, 768, 768, 26478336, 768, 768, 768, 26499840, 26512128, 265, 768, 768,
+  768, 768, 768, 768, 768, 768, 486, 486, 486, 486, 486, 486, 486, 768, 768, 768,
+  486, 486, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 265, 768, 768, 768, 263, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  0, 768, 768, 768, 768, 768, 768, 768, 768, 26523392, 0, 26553088, 26565376, 0, 26577664, 768,
+  768, 768, 265, 263, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 0,
+  768, 768, 768, 768, 768, 768, 768, 768, 26588928, 26601216, 26614528, 26626816, 768, 768, 768, 265,
+  263, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 265, 263, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 263, 768, 768, 768, 768, 768,
+  0, 768, 768, 768, 768, 26638080, 768, 768, 26651392, 768, 768, 768, 768, 265, 265, 768,
+  768, 768, 768, 768, 768, 768, 768, 265, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 265, 768, 768, 768, 768, 768, 768,
+  768, 768, 263, 768, 265, 265, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  257, 257, 257, 257, 257, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  486, 486, 486, 486, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  262, 262, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 257, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 26663424, 26675712,
+  26688000, 26704384, 26720768, 26737152, 26753536, 472, 472, 257, 257, 257, 768, 768, 768, 482, 472, 472,
+  472, 472, 472, 768, 768, 768, 768, 768, 768, 768, 768, 476, 476, 476, 476, 476,
+  476, 476, 476, 768, 768, 486, 486, 486, 486, 486, 476, 476, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 486, 486, 486, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 26769920, 26782208, 26794496, 26810880, 26827264,
+  26843648, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 486, 486, 486, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  58213120, 58221312, 58229504, 58237696, 58245888, 58254080, 58262272, 58270464, 58278656, 58286848, 58295040, 58303232, 58311424, 58319616, 58327808, 58336000,
+  58344192, 58352384, 58360576, 58368768, 58376960, 58385152, 58393344, 58401536, 58409728, 58417920, 58426112, 58434304, 58442496, 58450688, 58458880, 58467072,
+  58475264, 58483456, 58491648, 58499840, 58508032, 58516224, 58524416, 58532608, 58540800, 58548992, 58557184, 58565376, 58573568, 58581760, 58589952, 58598144,
+  58606336, 58614528, 58622720, 58630912, 58639104, 58647296, 58655488, 58663680, 58671872, 58680064, 58688256, 58696448, 58704640, 58712832, 58721024, 58729216,
+  58737408, 58745600, 58753792, 58761984, 58770176, 58778368, 58786560, 58794752, 58802944, 58811136, 58819328, 58827520, 58835712, 58843904, 58852096, 58860288,
+  58868480, 58876672, 58884864, 58893056, 58901248, 768, 58909440, 58917632, 58925824, 58934016, 58942208, 58950400, 58958592, 58966784, 58974976, 58983168,
+  58991360, 58999552, 59007744, 59015936, 59024128, 59032320, 59040512, 59048704, 59056896, 59065088, 59073280, 59081472, 59089664, 59097856, 59106048, 59114240,
+  59122432, 59130624, 59138816, 59147008, 59155200, 59163392, 59171584, 59179776, 59187968, 59196160, 59204352, 59212544, 59220736, 59228928, 59237120, 59245312,
+  59253504, 59261696, 59269888, 59278080, 59286272, 59294464, 59302656, 59310848, 59319040, 59327232, 59335424, 59343616, 59351808, 59360000, 59368192, 59376384,
+  59384576, 59392768, 59400960, 59409152, 59417344, 59425536, 59433728, 59441920, 59450112, 59458304, 59466496, 59474688, 59482880, 768, 59491072, 59499264,
+  768, 768, 59507456, 768, 768, 59515648, 59523840, 768, 768, 59532032, 59540224, 59548416, 59556608, 768, 59564800, 59572992,
+  59581184, 59589376, 59597568, 59605760, 59613952, 59622144, 59630336, 59638528, 59646720, 59654912, 768, 59663104, 768, 59671296, 59679488, 59687680,
+  59695872, 59704064, 59712256, 59720448, 768, 59728640, 59736832, 59745024, 59753216, 59761408, 59769600, 59777792, 59785984, 59794176, 59802368, 59810560,
+  59818752, 59826944, 59835136, 59843328, 59851520, 59859712, 59867904, 59876096, 59884288, 59892480, 59900672, 59908864, 59917056, 59925248, 59933440, 59941632,
+  59949824, 59958016, 59966208, 59974400, 59982592, 59990784, 59998976, 60007168, 60015360, 60023552, 60031744, 60039936, 60048128, 60056320, 60064512, 60072704,
+  60080896, 60089088, 60097280, 60105472, 60113664, 60121856, 60130048, 60138240, 60146432, 60154624, 60162816, 60171008, 60179200, 60187392, 60195584, 60203776,
+  60211968, 60220160, 60228352, 60236544, 60244736, 60252928, 768, 60261120, 60269312, 60277504, 60285696, 768, 768, 60293888, 60302080, 60310272,
+  60318464, 60326656, 60334848, 60343040, 60351232, 768, 60359424, 60367616, 60375808, 60384000, 60392192, 60400384, 60408576, 768, 60416768, 60424960,
+  60433152, 60441344, 60449536, 60457728, 60465920, 60474112, 60482304, 60490496, 60498688, 60506880, 60515072, 60523264, 60531456, 60539648, 60547840, 60556032,
+  60564224, 60572416, 60580608, 60588800, 60596992, 60605184, 60613376, 60621568, 60629760, 60637952, 768, 60646144, 60654336, 60662528, 60670720, 768,
+  60678912, 60687104, 60695296, 60703488, 60711680, 768, 60719872, 768, 768, 768, 60728064, 60736256, 60744448, 60752640, 60760832, 60769024,
+  60777216, 768, 60785408, 60793600, 60801792, 60809984, 60818176, 60826368, 60834560, 60842752, 60850944, 60859136, 60867328, 60875520, 60883712, 60891904,
+  60900096, 60908288, 60916480, 60924672, 60932864, 60941056, 60949248, 60957440, 60965632, 60973824, 60982016, 60990208, 60998400, 61006592, 61014784, 61022976,
+  61031168, 61039360, 61047552, 61055744, 61063936, 61072128, 61080320, 61088512, 61096704, 61104896, 61113088, 61121280, 61129472, 61137664, 61145856, 61154048,
+  61162240, 61170432, 61178624, 61186816, 61195008, 61203200, 61211392, 61219584, 61227776, 61235968, 61244160, 61252352, 61260544, 61268736, 61276928, 61285120,
+  61293312, 61301504, 61309696, 61317888, 61326080, 61334272, 61342464, 61350656, 61358848, 61367040, 61375232, 61383424, 61391616, 61399808, 61408000, 61416192,
+  61424384, 61432576, 61440768, 61448960, 61457152, 61465344, 61473536, 61481728, 61489920, 61498112, 61506304, 61514496, 61522688, 61530880, 61539072, 61547264,
+  61555456, 61563648, 61571840, 61580032, 61588224, 61596416, 61604608, 61612800, 61620992, 61629184, 61637376, 61645568, 61653760, 61661952, 61670144, 61678336,
+  61686528, 61694720, 61702912, 61711104, 61719296, 61727488, 61735680, 61743872, 61752064, 61760256, 61768448, 61776640, 61784832, 61793024, 61801216, 61809408,
+  61817600, 61825792, 61833984, 61842176, 61850368, 61858560, 61866752, 61874944, 61883136, 61891328, 61899520, 61907712, 61915904, 61924096, 61932288, 61940480,
+  61948672, 61956864, 61965056, 61973248, 61981440, 61989632, 61997824, 62006016, 62014208, 62022400, 62030592, 62038784, 62046976, 62055168, 62063360, 62071552,
+  62079744, 62087936, 62096128, 62104320, 62112512, 62120704, 62128896, 62137088, 62145280, 62153472, 62161664, 62169856, 62178048, 62186240, 62194432, 62202624,
+  62210816, 62219008, 62227200, 62235392, 62243584, 62251776, 62259968, 62268160, 62276352, 62284544, 62292736, 62300928, 62309120, 62317312, 62325504, 62333696,
+  62341888, 62350080, 62358272, 62366464, 62374656, 62382848, 62391040, 62399232, 62407424, 62415616, 62423808, 62432000, 62440192, 62448384, 62456576, 62464768,
+  62472960, 62481152, 62489344, 62497536, 62505728, 62513920, 62522112, 62530304, 62538496, 62546688, 62554880, 62563072, 62571264, 62579456, 62587648, 62595840,
+  62604032, 62612224, 62620416, 62628608, 62636800, 62644992, 62653184, 62661376, 62669568, 62677760, 62685952, 62694144, 62702336, 62710528, 62718720, 62726912,
+  62735104, 62743296, 62751488, 62759680, 62767872, 62776064, 62784256, 62792448, 62800640, 62808832, 62817024, 62825216, 62833408, 62841600, 62849792, 62857984,
+  62866176, 62874368, 62882560, 62890752, 62898944, 62907136, 62915328, 62923520, 62931712, 62939904, 62948096, 62956288, 62964480, 62972672, 62980864, 62989056,
+  62997248, 63005440, 63013632, 63021824, 63030016, 63038208, 63046400, 63054592, 63062784, 63070976, 63079168, 63087360, 63095552, 63103744, 63111936, 63120128,
+  63128320, 63136512, 63144704, 63152896, 63161088, 63169280, 63177472, 63185664, 63193856, 63202048, 63210240, 63218432, 63226624, 63234816, 63243008, 63251200,
+  63259392, 63267584, 63275776, 63283968, 63292160, 63300352, 63308544, 63316736, 63324928, 63333120, 63341312, 63349504, 63357696, 63365888, 63374080, 63382272,
+  63390464, 63398656, 63406848, 63415040, 63423232, 63431424, 63439616, 63447808, 63456000, 63464192, 63472384, 63480576, 63488768, 63496960, 63505152, 63513344,
+  63521536, 63529728, 63537920, 63546112, 63554304, 63562496, 768, 768, 63570688, 63578880, 63587072, 63595264, 63603456, 63611648, 63619840, 63628032,
+  63636224, 63644416, 63652608, 63660800, 63668992, 63677184, 63685376, 63693568, 63701760, 63709952, 63718144, 63726336, 63734528, 63742720, 63750912, 63759104,
+  63767296, 63775488, 63783680, 63791872, 63800064, 63808256, 63816448, 63824640, 63832832, 63841024, 63849216, 63857408, 63865600, 63873792, 63881984, 63890176,
+  63898368, 63906560, 63914752, 63922944, 63931136, 63939328, 63947520, 63955712, 63963904, 63972096, 63980288, 63988480, 63996672, 64004864, 64013056, 64021248,
+  64029440, 64037632, 64045824, 64054016, 64062208, 64070400, 64078592, 64086784, 64094976, 64103168, 64111360, 64119552, 64127744, 64135936, 64144128, 64152320,
+  64160512, 64168704, 64176896, 64185088, 64193280, 64201472, 64209664, 64217856, 64226048, 64234240, 64242432, 64250624, 64258816, 64267008, 64275200, 64283392,
+  64291584, 64299776, 64307968, 64316160, 64324352, 64332544, 64340736, 64348928, 64357120, 64365312, 64373504, 64381696, 64389888, 64398080, 64406272, 64414464,
+  64422656, 64430848, 64439040, 64447232, 64455424, 64463616, 64471808, 64480000, 64488192, 64496384, 64504576, 64512768, 64520960, 64529152, 64537344, 64545536,
+  64553728, 64561920, 64570112, 64578304, 64586496, 64594688, 64602880, 64611072, 64619264, 64627456, 64635648, 64643840, 64652032, 64660224, 64668416, 64676608,
+  64684800, 64692992, 64701184, 64709376, 64717568, 64725760, 64733952, 64742144, 64750336, 64758528, 64766720, 64774912, 64783104, 64791296, 64799488, 64807680,
+  64815872, 64824064, 64832256, 64840448, 64848640, 64856832, 64865024, 64873216, 64881408, 64889600, 64897792, 64905984, 64914176, 64922368, 64930560, 64938752,
+  64946944, 64955136, 64963328, 64971520, 64979712, 64987904, 64996096, 65004288, 65012480, 65020672, 65028864, 65037056, 65045248, 65053440, 65061632, 65069824,
+  65078016, 65086208, 65094400, 65102592, 65110784, 65118976, 65127168, 65135360, 65143552, 65151744, 65159936, 65168128, 65176320, 65184512, 65192704, 65200896,
+  65209088, 65217280, 65225472, 65233664, 65241856, 65250048, 65258240, 65266432, 65274624, 65282816, 65291008, 65299200, 65307392, 65315584, 65323776, 65331968,
+  65340160, 65348352, 65356544, 65364736, 65372928, 65381120, 65389312, 65397504, 65405696, 65413888, 65422080, 65430272, 65438464, 65446656, 65454848, 65463040,
+  65471232, 65479424, 65487616, 65495808, 65504000, 65512192, 65520384, 65528576, 65536768, 65544960, 65553152, 65561344, 65569536, 65577728, 65585920, 65594112,
+  65602304, 65610496, 65618688, 65626880, 65635072, 65643264, 65651456, 65659648, 65667840, 65676032, 65684224, 65692416, 65700608, 65708800, 65716992, 65725184,
+  65733376, 65741568, 65749760, 65757952, 65766144, 65774336, 65782528, 65790720, 65798912, 65807104, 65815296, 65823488, 65831680, 65839872, 65848064, 65856256,
+  65864448, 65872640, 65880832, 65889024, 65897216, 65905408, 65913600, 65921792, 65929984, 65938176, 65946368, 65954560, 768, 768, 65962752, 65970944,
+  65979136, 65987328, 65995520, 66003712, 66011904, 66020096, 66028288, 66036480, 66044672, 66052864, 66061056, 66069248, 66077440, 66085632, 66093824, 66102016,
+  66110208, 66118400, 66126592, 66134784, 66142976, 66151168, 66159360, 66167552, 66175744, 66183936, 66192128, 66200320, 66208512, 66216704, 66224896, 66233088,
+  66241280, 66249472, 66257664, 66265856, 66274048, 66282240, 66290432, 66298624, 66306816, 66315008, 66323200, 66331392, 66339584, 66347776, 66355968, 66364160,
+  486, 486, 486, 486, 486, 486, 486, 768, 486, 486, 486, 486, 486, 486, 486, 486,
+  486, 486, 486, 486, 486, 486, 486, 486, 486, 768, 768, 486, 486, 486, 486, 486,
+  486, 486, 768, 486, 486, 768, 486, 486, 486, 486, 486, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 486, 486, 486, 486,
+  476, 476, 476, 476, 476, 476, 476, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  768, 768, 768, 768, 486, 486, 486, 486, 486, 486, 263, 768, 768, 768, 768, 768,
+  66372352, 66380544, 66388736, 66396928, 768, 66405120, 66413312, 66421504, 66429696, 66437888, 66446080, 66454272, 66462464, 66470656, 66478848, 66487040,
+  66495232, 66503424, 66511616, 66519808, 66528000, 66536192, 66544384, 66552576, 66560768, 66568960, 66577152, 66585344, 66593536, 66601728, 66609920, 66618112,
+  768, 66626304, 66634496, 768, 66642688, 768, 768, 66650880, 768, 66659072, 66667264, 66675456, 66683648, 66691840, 66700032, 66708224,
+  66716416, 66724608, 66732800, 768, 66740992, 66749184, 66757376, 66765568, 768, 66773760, 768, 66781952, 768, 768, 768, 768,
+  768, 768, 66790144, 768, 768, 768, 768, 66798336, 768, 66806528, 768, 66814720, 768, 66822912, 66831104, 66839296,
+  768, 66847488, 66855680, 768, 66863872, 768, 768, 66872064, 768, 66880256, 768, 66888448, 768, 66896640, 768, 66904832,
+  768, 66913024, 66921216, 768, 66929408, 768, 768, 66937600, 66945792, 66953984, 66962176, 768, 66970368, 66978560, 66986752, 66994944,
+  67003136, 67011328, 67019520, 768, 67027712, 67035904, 67044096, 67052288, 768, 67060480, 67068672, 67076864, 67085056, 768, 67093248, 768,
+  67101440, 67109632, 67117824, 67126016, 67134208, 67142400, 67150592, 67158784, 67166976, 67175168, 768, 67183360, 67191552, 67199744, 67207936, 67216128,
+  67224320, 67232512, 67240704, 67248896, 67257088, 67265280, 67273472, 67281664, 67289856, 67298048, 67306240, 67314432, 768, 768, 768, 768,
+  768, 67322624, 67330816, 67339008, 768, 67347200, 67355392, 67363584, 67371776, 67379968, 768, 67388160, 67396352, 67404544, 67412736, 67420928,
+  67429120, 67437312, 67445504, 67453696, 67461888, 67470080, 67478272, 67486464, 67494656, 67502848, 67511040, 67519232, 768, 768, 768, 768,
+  67527424, 67539712, 67552000, 67564288, 67576576, 67588864, 67601152, 67613440, 67625728, 67638016, 67650304, 768, 768, 768, 768, 768,
+  67662592, 67678976, 67695360, 67711744, 67728128, 67744512, 67760896, 67777280, 67793664, 67810048, 67826432, 67842816, 67859200, 67875584, 67891968, 67908352,
+  67924736, 67941120, 67957504, 67973888, 67990272, 68006656, 68023040, 68039424, 68055808, 68072192, 68088576, 68104960, 68113152, 68121344, 68133632, 768,
+  68145920, 68154112, 68162304, 68170496, 68178688, 68186880, 68195072, 68203264, 68211456, 68219648, 68227840, 68236032, 68244224, 68252416, 68260608, 68268800,
+  68276992, 68285184, 68293376, 68301568, 68309760, 68317952, 68326144, 68334336, 68342528, 68350720, 68358912, 68371200, 68383488, 68395776, 68408064, 68424448,
+  768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 68436736, 68449024, 68461312, 768, 768, 768,
+  68473600, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  68485888, 68498176, 68510464, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  68518656, 68526848, 68535040, 68543232, 68555520, 68563712, 68571904, 68580096, 68588288, 68596480, 68604672, 68612864, 68621056, 68629248, 68637440, 68645632,
+  68653824, 68662016, 68670208, 68678400, 68686592, 68694784, 68702976, 68711168, 68719360, 68727552, 68735744, 68743936, 68752128, 68760320, 68768512, 68776704,
+  68784896, 68793088, 68801280, 68809472, 68817664, 68825856, 68834048, 68842240, 68850432, 68858624, 68866816, 68875008, 768, 768, 768, 768,
+  68883200, 68899584, 68915968, 68932352, 68948736, 68965120, 68981504, 68997888, 69014272, 768, 768, 768, 768, 768, 768, 768,
+  69030656, 69038848, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+  69047040, 69055232, 69063424, 69071616, 69079808, 69088000, 69096192, 69104384, 69112576, 69120768, 768, 768, 768, 768, 768, 768,
+  26860032, 26868224, 26876416, 26884608, 26892800, 26900992, 26909184, 26917376, 26925568, 26933760, 26941952, 26950144, 26958336, 26966528, 26974720, 26982912,
+  26991104, 26999296, 27007488, 27015680, 27023872, 27032064, 27040256, 27048448, 27056640, 27064832, 27073024, 27081216, 27089408, 27097600, 27105792, 27113984,
+  27122176, 27130368, 27138560, 27146752, 27154944, 27163136, 27171328, 27179520, 27187712, 27195904, 27204096, 27212288, 27220480, 27228672, 27236864, 27245056,
+  27253248, 27261440, 27269632, 27277824, 27286016, 27294208, 27302400, 27310592, 27318784, 27326976, 27335168, 27343360, 27351552, 27359744, 27367936, 27376128,
+  27384320, 27392512, 27400704, 27408896, 27417088, 27425280, 27433472, 27441664, 27449856, 27458048, 27466240, 27474432, 27482624, 27490816, 27499008, 27507200,
+  27515392, 27523584, 27531776, 27539968, 27548160, 27556352, 27564544, 27572736, 27580928, 27589120, 27597312, 27605504, 27613696, 27621888, 27630080, 27638272,
+  27646464, 27654656, 27662848, 27671040, 27679232, 27687424, 27695616, 27703808, 27712000, 27720192, 27728384, 27736576, 27744768, 27752960, 27761152, 27769344,
+  27777536, 27785728, 27793920, 27802112, 27810304, 27818496, 27826688, 27834880, 27843072, 27851264, 27859456, 27867648, 27875840, 27884032, 27892224, 27900416,
+  27908608, 27916800, 27924992, 27933184, 27941376, 27949568, 27957760, 27965952, 27974144, 27982336, 27990528, 27998720, 28006912, 28015104, 28023296, 28031488,
+  28039680, 28047872, 28056064, 28064256, 28072448, 28080640, 28088832, 28097024, 28105216, 28113408, 28121600, 28129792, 28137984, 28146176, 28154368, 28162560,
+  28170752, 28178944, 28187136, 28195328, 28203520, 28211712, 28219904, 28228096, 28236288, 28244480, 28252672, 28260864, 28269056, 28277248, 28285440, 28293632,
+  28301824, 28310016, 28318208, 28326400, 28334592, 28342784, 28350976, 28359168, 28367360, 28375552, 28383744, 28391936, 28400128, 28408320, 28416512, 28424704,
+  28432896, 28441088, 28449280, 28457472, 28465664, 28473856, 28482048, 28490240, 28498432, 28506624, 28514816, 28523008, 28531200, 28539392, 28547584, 28555776,
+  28563968, 28572160, 28580352, 28588544, 28596736, 28604928, 28613120, 28621312, 28629504, 28637696, 28645888, 28654080, 28662272, 28670464, 28678656, 28686848,
+  28695040, 28703232, 28711424, 28719616, 28727808, 28736000, 28744192, 28752384, 28760576, 28768768, 28776960, 28785152, 28793344, 28801536, 28809728, 28817920,
+  28826112, 28834304, 28842496, 28850688, 28858880, 28867072, 28875264, 28883456, 28891648, 28899840, 28908032, 28916224, 28924416, 28932608, 28940800, 28948992,
+  28957184, 28965376, 28973568, 28981760, 28989952, 28998144, 29006336, 29014528, 29022720, 29030912, 29039104, 29047296, 29055488, 29063680, 29071872, 29080064,
+  29088256, 29096448, 29104640, 29112832, 29121024, 29129216, 29137408, 29145600, 29153792, 29161984, 29170176, 29178368, 29186560, 29194752, 29202944, 29211136,
+  29219328, 29227520, 29235712, 29243904, 29252096, 29260288, 29268480, 29276672, 29284864, 29293056, 29301248, 29309440, 29317632, 29325824, 29334016, 29342208,
+  29350400, 29358592, 29366784, 29374976, 29383168, 29391360, 29399552, 29407744, 29415936, 29424128, 29432320, 29440512, 29448704, 29456896, 29465088, 29473280,
+  29481472, 29489664, 29497856, 29506048, 29514240, 29522432, 29530624, 29538816, 29547008, 29555200, 29563392, 29571584, 29579776, 29587968, 29596160, 29604352,
+  29612544, 29620736, 29628928, 29637120, 29645312, 29653504, 29661696, 29669888, 29678080, 29686272, 29694464, 29702656, 29710848, 29719040, 29727232, 29735424,
+  29743616, 29751808, 29760000, 29768192, 29776384, 29784576, 29792768, 29800960, 29809152, 29817344, 29825536, 29833728, 29841920, 29850112, 29858304, 29866496,
+  29874688, 29882880, 29891072, 29899264, 29907456, 29915648, 29923840, 29932032, 29940224, 29948416, 29956608, 29964800, 29972992, 29981184, 29989376, 29997568,
+  30005760, 30013952, 30022144, 30030336, 30038528, 30046720, 30054912, 30063104, 30071296, 30079488, 30087680, 30095872, 30104064, 30112256, 30120448, 30128640,
+  30136832, 30145024, 30153216, 30161408, 30169600, 30177792, 30185984, 30194176, 30202368, 30210560, 30218752, 30226944, 30235136, 30243328, 30251520, 30259712,
+  30267904, 30276096, 30284288, 30292480, 30300672, 30308864, 30317056, 30325248, 30333440, 30341632, 30349824, 30358016, 30366208, 30374400, 30382592, 30390784,
+  30398976, 30407168, 30415360, 30423552, 30431744, 30439936, 30448128, 30456320, 30464512, 30472704, 30480896, 30489088, 30497280, 30505472, 30513664, 30521856,
+  30530048, 30538240, 30546432, 30554624, 30562816, 30571008, 30579200, 30587392, 30595584, 30603776, 30611968, 30620160, 30628352, 30636544, 30644736, 30652928,
+  30661120, 30669312, 30677504, 30685696, 30693888, 30702080, 30710272, 30718464, 30726656, 30734848, 30743040, 30751232, 30759424, 30767616, 30775808, 30784000,
+  30792192, 30800384, 30808576, 30816768, 30824960, 30833152, 30841344, 30849536, 30857728, 30865920, 30874112, 30882304, 30890496, 30898688, 30906880, 30915072,
+  30923264, 30931456, 30939648, 30947840, 30956032, 30964224, 30972416, 30980608, 30988800, 30996992, 31005184, 31013376, 31021568, 31029760, 31037952, 31046144,
+  31054336, 31062528, 31070720, 31078912, 31087104, 31095296, 31103488, 31111680, 31119872, 31128064, 31136256, 31144448, 31152640, 31160832, 31169024, 31177216,
+  31185408, 31193600, 31201792, 31209984, 31218176, 31226368, 31234560, 31242752, 31250944, 31259136, 31267328, 31275520, 31283712, 31291904, 768, 768,
+};
+
+const char32_t uninorms::normalization_data[] = {
+  0, 256, 824, 8814, 256, 824, 8800, 256, 824, 8815, 4096, 768, 192, 769, 193, 770,
+  194, 771, 195, 772, 256, 774, 258, 775, 550, 776, 196, 777, 7842, 778, 197, 780,
+  461, 783, 512, 785, 514, 803, 7840, 805, 7680, 808, 260, 768, 775, 7682, 803, 7684,
+  817, 7686, 1280, 769, 262, 770, 264, 775, 266, 780, 268, 807, 199, 1536, 775, 7690,
+  780, 270, 803, 7692, 807, 7696, 813, 7698, 817, 7694, 4352, 768, 200, 769, 201, 770,
+  202, 771, 7868, 772, 274, 774, 276, 775, 278, 776, 203, 777, 7866, 780, 282, 783,
+  516, 785, 518, 803, 7864, 807, 552, 808, 280, 813, 7704, 816, 7706, 256, 775, 7710,
+  1792, 769, 500, 770, 284, 772, 7712, 774, 286, 775, 288, 780, 486, 807, 290, 1792,
+  770, 292, 775, 7714, 776, 7718, 780, 542, 803, 7716, 807, 7720, 814, 7722, 3840, 768,
+  204, 769, 205, 770, 206, 771, 296, 772, 298, 774, 300, 775, 304, 776, 207, 777,
+  7880, 780, 463, 783, 520, 785, 522, 803, 7882, 808, 302, 816, 7724, 256, 770, 308,
+  1280, 769, 7728, 780, 488, 803, 7730, 807, 310, 817, 7732, 1536, 769, 313, 780, 317,
+  803, 7734, 807, 315, 813, 7740, 817, 7738, 768, 769, 7742, 775, 7744, 803, 7746, 2304,
+  768, 504, 769, 323, 771, 209, 775, 7748, 780, 327, 803, 7750, 807, 325, 813, 7754,
+  817, 7752, 4096, 768, 210, 769, 211, 770, 212, 771, 213, 772, 332, 774, 334, 775,
+  558, 776, 214, 777, 7886, 779, 336, 780, 465, 783, 524, 785, 526, 795, 416, 803,
+  7884, 808, 490, 512, 769, 7764, 775, 7766, 2048, 769, 340, 775, 7768, 780, 344, 783,
+  528, 785, 530, 803, 7770, 807, 342, 817, 7774, 1792, 769, 346, 770, 348, 775, 7776,
+  780, 352, 803, 7778, 806, 536, 807, 350, 1792, 775, 7786, 780, 356, 803, 7788, 806,
+  538, 807, 354, 813, 7792, 817, 7790, 4864, 768, 217, 769, 218, 770, 219, 771, 360,
+  772, 362, 774, 364, 776, 220, 777, 7910, 778, 366, 779, 368, 780, 467, 783, 532,
+  785, 534, 795, 431, 803, 7908, 804, 7794, 808, 370, 813, 7798, 816, 7796, 512, 771,
+  7804, 803, 7806, 1536, 768, 7808, 769, 7810, 770, 372, 775, 7814, 776, 7812, 803, 7816,
+  512, 775, 7818, 776, 7820, 2304, 768, 7922, 769, 221, 770, 374, 771, 7928, 772, 562,
+  775, 7822, 776, 376, 777, 7926, 803, 7924, 1536, 769, 377, 770, 7824, 775, 379, 780,
+  381, 803, 7826, 817, 7828, 4096, 768, 224, 769, 225, 770, 226, 771, 227, 772, 257,
+  774, 259, 775, 551, 776, 228, 777, 7843, 778, 229, 780, 462, 783, 513, 785, 515,
+  803, 7841, 805, 7681, 808, 261, 768, 775, 7683, 803, 7685, 817, 7687, 1280, 769, 263,
+  770, 265, 775, 267, 780, 269, 807, 231, 1536, 775, 7691, 780, 271, 803, 7693, 807,
+  7697, 813, 7699, 817, 7695, 4352, 768, 232, 769, 233, 770, 234, 771, 7869, 772, 275,
+  774, 277, 775, 279, 776, 235, 777, 7867, 780, 283, 783, 517, 785, 519, 803, 7865,
+  807, 553, 808, 281, 813, 7705, 816, 7707, 256, 775, 7711, 1792, 769, 501, 770, 285,
+  772, 7713, 774, 287, 775, 289, 780, 487, 807, 291, 2048, 770, 293, 775, 7715, 776,
+  7719, 780, 543, 803, 7717, 807, 7721, 814, 7723, 817, 7830, 3584, 768, 236, 769, 237,
+  770, 238, 771, 297, 772, 299, 774, 301, 776, 239, 777, 7881, 780, 464, 783, 521,
+  785, 523, 803, 7883, 808, 303, 816, 7725, 512, 770, 309, 780, 496, 1280, 769, 7729,
+  780, 489, 803, 7731, 807, 311, 817, 7733, 1536, 769, 314, 780, 318, 803, 7735, 807,
+  316, 813, 7741, 817, 7739, 768, 769, 7743, 775, 7745, 803, 7747, 2304, 768, 505, 769,
+  324, 771, 241, 775, 7749, 780, 328, 803, 7751, 807, 326, 813, 7755, 817, 7753, 4096,
+  768, 242, 769, 243, 770, 244, 771, 245, 772, 333, 774, 335, 775, 559, 776, 246,
+  777, 7887, 779, 337, 780, 466, 783, 525, 785, 527, 795, 417, 803, 7885, 808, 491,
+  512, 769, 7765, 775, 7767, 2048, 769, 341, 775, 7769, 780, 345, 783, 529, 785, 531,
+  803, 7771, 807, 343, 817, 7775, 1792, 769, 347, 770, 349, 775, 7777, 780, 353, 803,
+  7779, 806, 537, 807, 351, 2048, 775, 7787, 776, 7831, 780, 357, 803, 7789, 806, 539,
+  807, 355, 813, 7793, 817, 7791, 4864, 768, 249, 769, 250, 770, 251, 771, 361, 772,
+  363, 774, 365, 776, 252, 777, 7911, 778, 367, 779, 369, 780, 468, 783, 533, 785,
+  535, 795, 432, 803, 7909, 804, 7795, 808, 371, 813, 7799, 816, 7797, 512, 771, 7805,
+  803, 7807, 1792, 768, 7809, 769, 7811, 770, 373, 775, 7815, 776, 7813, 778, 7832, 803,
+  7817, 512, 775, 7819, 776, 7821, 2560, 768, 7923, 769, 253, 770, 375, 771, 7929, 772,
+  563, 775, 7823, 776, 255, 777, 7927, 778, 7833, 803, 7925, 1536, 769, 378, 770, 7825,
+  775, 380, 780, 382, 803, 7827, 817, 7829, 784, 32, 776, 768, 8173, 769, 901, 834,
+  8129, 2, 65, 768, 2, 65, 769, 1026, 65, 770, 768, 7846, 769, 7844, 771, 7850,
+  777, 7848, 2, 65, 771, 258, 65, 776, 772, 478, 258, 65, 778, 769, 506, 512,
+  769, 508, 772, 482, 258, 67, 807, 769, 7688, 2, 69, 768, 2, 69, 769, 1026,
+  69, 770, 768, 7872, 769, 7870, 771, 7876, 777, 7874, 2, 69, 776, 2, 73, 768,
+  2, 73, 769, 2, 73, 770, 258, 73, 776, 769, 7726, 2, 78, 771, 2, 79,
+  768, 2, 79, 769, 1026, 79, 770, 768, 7890, 769, 7888, 771, 7894, 777, 7892, 770,
+  79, 771, 769, 7756, 772, 556, 776, 7758, 258, 79, 776, 772, 554, 256, 769, 510,
+  2, 85, 768, 2, 85, 769, 2, 85, 770, 1026, 85, 776, 768, 475, 769, 471,
+  772, 469, 780, 473, 2, 89, 769, 2, 97, 768, 2, 97, 769, 1026, 97, 770,
+  768, 7847, 769, 7845, 771, 7851, 777, 7849, 2, 97, 771, 258, 97, 776, 772, 479,
+  258, 97, 778, 769, 507, 512, 769, 509, 772, 483, 258, 99, 807, 769, 7689, 2,
+  101, 768, 2, 101, 769, 1026, 101, 770, 768, 7873, 769, 7871, 771, 7877, 777, 7875,
+  2, 101, 776, 2, 105, 768, 2, 105, 769, 2, 105, 770, 258, 105, 776, 769,
+  7727, 2, 110, 771, 2, 111, 768, 2, 111, 769, 1026, 111, 770, 768, 7891, 769,
+  7889, 771, 7895, 777, 7893, 770, 111, 771, 769, 7757, 772, 557, 776, 7759, 258, 111,
+  776, 772, 555, 256, 769, 511, 2, 117, 768, 2, 117, 769, 2, 117, 770, 1026,
+  117, 776, 768, 476, 769, 472, 772, 470, 780, 474, 2, 121, 769, 2, 121, 776,
+  2, 65, 772, 2, 97, 772, 1026, 65, 774, 768, 7856, 769, 7854, 771, 7860, 777,
+  7858, 1026, 97, 774, 768, 7857, 769, 7855, 771, 7861, 777, 7859, 2, 65, 808, 2,
+  97, 808, 2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99, 770, 2, 67,
+  775, 2, 99, 775, 2, 67, 780, 2, 99, 780, 2, 68, 780, 2, 100, 780,
+  514, 69, 772, 768, 7700, 769, 7702, 514, 101, 772, 768, 7701, 769, 7703, 2, 69,
+  774, 2, 101, 774, 2, 69, 775, 2, 101, 775, 2, 69, 808, 2, 101, 808,
+  2, 69, 780, 2, 101, 780, 2, 71, 770, 2, 103, 770, 2, 71, 774, 2,
+  103, 774, 2, 71, 775, 2, 103, 775, 2, 71, 807, 2, 103, 807, 2, 72,
+  770, 2, 104, 770, 2, 73, 771, 2, 105, 771, 2, 73, 772, 2, 105, 772,
+  2, 73, 774, 2, 105, 774, 2, 73, 808, 2, 105, 808, 2, 73, 775, 2,
+  74, 770, 2, 106, 770, 2, 75, 807, 2, 107, 807, 2, 76, 769, 2, 108,
+  769, 2, 76, 807, 2, 108, 807, 2, 76, 780, 2, 108, 780, 2, 78, 769,
+  2, 110, 769, 2, 78, 807, 2, 110, 807, 2, 78, 780, 2, 110, 780, 514,
+  79, 772, 768, 7760, 769, 7762, 514, 111, 772, 768, 7761, 769, 7763, 2, 79, 774,
+  2, 111, 774, 2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769, 2,
+  82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780, 258, 83, 769, 775, 7780,
+  258, 115, 769, 775, 7781, 2, 83, 770, 2, 115, 770, 2, 83, 807, 2, 115,
+  807, 258, 83, 780, 775, 7782, 258, 115, 780, 775, 7783, 2, 84, 807, 2, 116,
+  807, 2, 84, 780, 2, 116, 780, 258, 85, 771, 769, 7800, 258, 117, 771, 769,
+  7801, 258, 85, 772, 776, 7802, 258, 117, 772, 776, 7803, 2, 85, 774, 2, 117,
+  774, 2, 85, 778, 2, 117, 778, 2, 85, 779, 2, 117, 779, 2, 85, 808,
+  2, 117, 808, 2, 87, 770, 2, 119, 770, 2, 89, 770, 2, 121, 770, 2,
+  89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775, 2, 122, 775, 2, 90,
+  780, 2, 122, 780, 264, 115, 775, 7835, 1282, 79, 795, 768, 7900, 769, 7898, 771,
+  7904, 777, 7902, 803, 7906, 1282, 111, 795, 768, 7901, 769, 7899, 771, 7905, 777, 7903,
+  803, 7907, 1282, 85, 795, 768, 7914, 769, 7912, 771, 7918, 777, 7916, 803, 7920, 1282,
+  117, 795, 768, 7915, 769, 7913, 771, 7919, 777, 7917, 803, 7921, 256, 780, 494, 2,
+  65, 780, 2, 97, 780, 2, 73, 780, 2, 105, 780, 2, 79, 780, 2, 111,
+  780, 2, 85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776, 772, 3,
+  85, 776, 769, 3, 117, 776, 769, 3, 85, 776, 780, 3, 117, 776, 780, 3,
+  85, 776, 768, 3, 117, 776, 768, 3, 65, 776, 772, 3, 97, 776, 772, 3,
+  65, 775, 772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2, 71, 780,
+  2, 103, 780, 2, 75, 780, 2, 107, 780, 258, 79, 808, 772, 492, 258, 111,
+  808, 772, 493, 3, 79, 808, 772, 3, 111, 808, 772, 2, 439, 780, 2, 658,
+  780, 2, 106, 780, 2, 71, 769, 2, 103, 769, 2, 78, 768, 2, 110, 768,
+  3, 65, 778, 769, 3, 97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216,
+  769, 2, 248, 769, 2, 65, 783, 2, 97, 783, 2, 65, 785, 2, 97, 785,
+  2, 69, 783, 2, 101, 783, 2, 69, 785, 2, 101, 785, 2, 73, 783, 2,
+  105, 783, 2, 73, 785, 2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79,
+  785, 2, 111, 785, 2, 82, 783, 2, 114, 783, 2, 82, 785, 2, 114, 785,
+  2, 85, 783, 2, 117, 783, 2, 85, 785, 2, 117, 785, 2, 83, 806, 2,
+  115, 806, 2, 84, 806, 2, 116, 806, 2, 72, 780, 2, 104, 780, 258, 65,
+  775, 772, 480, 258, 97, 775, 772, 481, 258, 69, 807, 774, 7708, 258, 101, 807,
+  774, 7709, 3, 79, 776, 772, 3, 111, 776, 772, 3, 79, 771, 772, 3, 111,
+  771, 772, 258, 79, 775, 772, 560, 258, 111, 775, 772, 561, 3, 79, 775, 772,
+  3, 111, 775, 772, 2, 89, 772, 2, 121, 772, 256, 780, 495, 1, 768, 1,
+  769, 1, 787, 2, 776, 769, 1, 697, 1, 59, 26, 168, 769, 32, 776, 769,
+  2, 913, 769, 1, 183, 2, 917, 769, 2, 919, 769, 2, 921, 769, 2, 927,
+  769, 2, 933, 769, 2, 937, 769, 3, 953, 776, 769, 1792, 768, 8122, 769, 902,
+  772, 8121, 774, 8120, 787, 7944, 788, 7945, 837, 8124, 1024, 768, 8136, 769, 904, 787,
+  7960, 788, 7961, 1280, 768, 8138, 769, 905, 787, 7976, 788, 7977, 837, 8140, 1792, 768,
+  8154, 769, 906, 772, 8153, 774, 8152, 776, 938, 787, 7992, 788, 7993, 1024, 768, 8184,
+  769, 908, 787, 8008, 788, 8009, 256, 788, 8172, 1536, 768, 8170, 769, 910, 772, 8169,
+  774, 8168, 776, 939, 788, 8025, 1280, 768, 8186, 769, 911, 787, 8040, 788, 8041, 837,
+  8188, 2, 921, 776, 2, 933, 776, 258, 945, 769, 837, 8116, 2, 949, 769, 258,
+  951, 769, 837, 8132, 2, 953, 769, 3, 965, 776, 769, 2048, 768, 8048, 769, 940,
+  772, 8113, 774, 8112, 787, 7936, 788, 7937, 834, 8118, 837, 8115, 1024, 768, 8050, 769,
+  941, 787, 7952, 788, 7953, 1536, 768, 8052, 769, 942, 787, 7968, 788, 7969, 834, 8134,
+  837, 8131, 2048, 768, 8054, 769, 943, 772, 8145, 774, 8144, 776, 970, 787, 7984, 788,
+  7985, 834, 8150, 1024, 768, 8056, 769, 972, 787, 8000, 788, 8001, 512, 787, 8164, 788,
+  8165, 2048, 768, 8058, 769, 973, 772, 8161, 774, 8160, 776, 971, 787, 8016, 788, 8017,
+  834, 8166, 1536, 768, 8060, 769, 974, 787, 8032, 788, 8033, 834, 8182, 837, 8179, 770,
+  953, 776, 768, 8146, 769, 912, 834, 8151, 770, 965, 776, 768, 8162, 769, 944, 834,
+  8167, 2, 959, 769, 2, 965, 769, 258, 969, 769, 837, 8180, 520, 933, 769, 979,
+  776, 980, 18, 978, 769, 933, 769, 18, 978, 776, 933, 776, 2, 1045, 768, 2,
+  1045, 776, 2, 1043, 769, 256, 776, 1031, 2, 1030, 776, 2, 1050, 769, 2, 1048,
+  768, 2, 1059, 774, 512, 774, 1232, 776, 1234, 256, 769, 1027, 768, 768, 1024, 774,
+  1238, 776, 1025, 512, 774, 1217, 776, 1244, 256, 776, 1246, 1024, 768, 1037, 772, 1250,
+  774, 1049, 776, 1252, 2, 1048, 774, 256, 769, 1036, 256, 776, 1254, 1024, 772, 1262,
+  774, 1038, 776, 1264, 779, 1266, 256, 776, 1268, 256, 776, 1272, 256, 776, 1260, 512,
+  774, 1233, 776, 1235, 256, 769, 1107, 768, 768, 1104, 774, 1239, 776, 1105, 512, 774,
+  1218, 776, 1245, 256, 776, 1247, 1024, 768, 1117, 772, 1251, 774, 1081, 776, 1253, 2,
+  1080, 774, 256, 769, 1116, 256, 776, 1255, 1024, 772, 1263, 774, 1118, 776, 1265, 779,
+  1267, 256, 776, 1269, 256, 776, 1273, 256, 776, 1261, 2, 1077, 768, 2, 1077, 776,
+  2, 1075, 769, 256, 776, 1111, 2, 1110, 776, 2, 1082, 769, 2, 1080, 768, 2,
+  1091, 774, 256, 783, 1142, 256, 783, 1143, 2, 1140, 783, 2, 1141, 783, 2, 1046,
+  774, 2, 1078, 774, 2, 1040, 774, 2, 1072, 774, 2, 1040, 776, 2, 1072, 776,
+  2, 1045, 774, 2, 1077, 774, 256, 776, 1242, 256, 776, 1243, 2, 1240, 776, 2,
+  1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2, 1079, 776, 2, 1048,
+  772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776, 2, 1054, 776, 2, 1086, 776,
+  256, 776, 1258, 256, 776, 1259, 2, 1256, 776, 2, 1257, 776, 2, 1069, 776, 2,
+  1101, 776, 2, 1059, 772, 2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059,
+  779, 2, 1091, 779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776,
+  2, 1575, 1619, 2, 1575, 1620, 2, 1608, 1620, 2, 1575, 1621, 2, 1610, 1620, 768,
+  1619, 1570, 1620, 1571, 1621, 1573, 256, 1620, 1572, 256, 1620, 1574, 2, 1749, 1620, 256,
+  1620, 1730, 2, 1729, 1620, 256, 1620, 1747, 2, 1746, 1620, 256, 1620, 1728, 256, 2364,
+  2345, 2, 2344, 2364, 256, 2364, 2353, 2, 2352, 2364, 256, 2364, 2356, 2, 2355, 2364,
+  2, 2325, 2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332, 2364, 2, 2337, 2364, 2,
+  2338, 2364, 2, 2347, 2364, 2, 2351, 2364, 512, 2494, 2507, 2519, 2508, 2, 2503, 2494,
+  2, 2503, 2519, 2, 2465, 2492, 2, 2466, 2492, 2, 2479, 2492, 2, 2610, 2620, 2,
+  2616, 2620, 2, 2582, 2620, 2, 2583, 2620, 2, 2588, 2620, 2, 2603, 2620, 768, 2878,
+  2891, 2902, 2888, 2903, 2892, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903, 2, 2849,
+  2876, 2, 2850, 2876, 256, 3031, 2964, 2, 2962, 3031, 512, 3006, 3018, 3031, 3020, 256,
+  3006, 3019, 2, 3014, 3006, 2, 3015, 3006, 2, 3014, 3031, 256, 3158, 3144, 2, 3142,
+  3158, 256, 3285, 3264, 2, 3263, 3285, 768, 3266, 3274, 3285, 3271, 3286, 3272, 2, 3270,
+  3285, 2, 3270, 3286, 258, 3270, 3266, 3285, 3275, 3, 3270, 3266, 3285, 512, 3390, 3402,
+  3415, 3404, 256, 3390, 3403, 2, 3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 768, 3530,
+  3546, 3535, 3548, 3551, 3550, 2, 3545, 3530, 258, 3545, 3535, 3530, 3549, 3, 3545, 3535,
+  3530, 2, 3545, 3551, 2, 3906, 4023, 2, 3916, 4023, 2, 3921, 4023, 2, 3926, 4023,
+  2, 3931, 4023, 2, 3904, 4021, 2, 3953, 3954, 2, 3953, 3956, 2, 4018, 3968, 2,
+  4019, 3968, 2, 3953, 3968, 2, 3986, 4023, 2, 3996, 4023, 2, 4001, 4023, 2, 4006,
+  4023, 2, 4011, 4023, 2, 3984, 4021, 256, 4142, 4134, 2, 4133, 4142, 256, 6965, 6918,
+  2, 6917, 6965, 256, 6965, 6920, 2, 6919, 6965, 256, 6965, 6922, 2, 6921, 6965, 256,
+  6965, 6924, 2, 6923, 6965, 256, 6965, 6926, 2, 6925, 6965, 256, 6965, 6930, 2, 6929,
+  6965, 256, 6965, 6971, 2, 6970, 6965, 256, 6965, 6973, 2, 6972, 6965, 256, 6965, 6976,
+  256, 6965, 6977, 2, 6974, 6965, 2, 6975, 6965, 256, 6965, 6979, 2, 6978, 6965, 2,
+  65, 805, 2, 97, 805, 2, 66, 775, 2, 98, 775, 2, 66, 803, 2, 98,
+  803, 2, 66, 817, 2, 98, 817, 3, 67, 807, 769, 3, 99, 807, 769, 2,
+  68, 775, 2, 100, 775, 2, 68, 803, 2, 100, 803, 2, 68, 817, 2, 100,
+  817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100, 813, 3, 69, 772,
+  768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101, 772, 769, 2, 69, 813,
+  2, 101, 813, 2, 69, 816, 2, 101, 816, 3, 69, 807, 774, 3, 101, 807,
+  774, 2, 70, 775, 2, 102, 775, 2, 71, 772, 2, 103, 772, 2, 72, 775,
+  2, 104, 775, 2, 72, 803, 2, 104, 803, 2, 72, 776, 2, 104, 776, 2,
+  72, 807, 2, 104, 807, 2, 72, 814, 2, 104, 814, 2, 73, 816, 2, 105,
+  816, 3, 73, 776, 769, 3, 105, 776, 769, 2, 75, 769, 2, 107, 769, 2,
+  75, 803, 2, 107, 803, 2, 75, 817, 2, 107, 817, 258, 76, 803, 772, 7736,
+  258, 108, 803, 772, 7737, 3, 76, 803, 772, 3, 108, 803, 772, 2, 76, 817,
+  2, 108, 817, 2, 76, 813, 2, 108, 813, 2, 77, 769, 2, 109, 769, 2,
+  77, 775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2, 110,
+  775, 2, 78, 803, 2, 110, 803, 2, 78, 817, 2, 110, 817, 2, 78, 813,
+  2, 110, 813, 3, 79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3,
+  111, 771, 776, 3, 79, 772, 768, 3, 111, 772, 768, 3, 79, 772, 769, 3,
+  111, 772, 769, 2, 80, 769, 2, 112, 769, 2, 80, 775, 2, 112, 775, 2,
+  82, 775, 2, 114, 775, 258, 82, 803, 772, 7772, 258, 114, 803, 772, 7773, 3,
+  82, 803, 772, 3, 114, 803, 772, 2, 82, 817, 2, 114, 817, 2, 83, 775,
+  2, 115, 775, 258, 83, 803, 775, 7784, 258, 115, 803, 775, 7785, 3, 83, 769,
+  775, 3, 115, 769, 775, 3, 83, 780, 775, 3, 115, 780, 775, 3, 83, 803,
+  775, 3, 115, 803, 775, 2, 84, 775, 2, 116, 775, 2, 84, 803, 2, 116,
+  803, 2, 84, 817, 2, 116, 817, 2, 84, 813, 2, 116, 813, 2, 85, 804,
+  2, 117, 804, 2, 85, 816, 2, 117, 816, 2, 85, 813, 2, 117, 813, 3,
+  85, 771, 769, 3, 117, 771, 769, 3, 85, 772, 776, 3, 117, 772, 776, 2,
+  86, 771, 2, 118, 771, 2, 86, 803, 2, 118, 803, 2, 87, 768, 2, 119,
+  768, 2, 87, 769, 2, 119, 769, 2, 87, 776, 2, 119, 776, 2, 87, 775,
+  2, 119, 775, 2, 87, 803, 2, 119, 803, 2, 88, 775, 2, 120, 775, 2,
+  88, 776, 2, 120, 776, 2, 89, 775, 2, 121, 775, 2, 90, 770, 2, 122,
+  770, 2, 90, 803, 2, 122, 803, 2, 90, 817, 2, 122, 817, 2, 104, 817,
+  2, 116, 776, 2, 119, 778, 2, 121, 778, 18, 383, 775, 115, 775, 514, 65,
+  803, 770, 7852, 774, 7862, 514, 97, 803, 770, 7853, 774, 7863, 2, 65, 777, 2,
+  97, 777, 3, 65, 770, 769, 3, 97, 770, 769, 3, 65, 770, 768, 3, 97,
+  770, 768, 3, 65, 770, 777, 3, 97, 770, 777, 3, 65, 770, 771, 3, 97,
+  770, 771, 3, 65, 803, 770, 3, 97, 803, 770, 3, 65, 774, 769, 3, 97,
+  774, 769, 3, 65, 774, 768, 3, 97, 774, 768, 3, 65, 774, 777, 3, 97,
+  774, 777, 3, 65, 774, 771, 3, 97, 774, 771, 3, 65, 803, 774, 3, 97,
+  803, 774, 258, 69, 803, 770, 7878, 258, 101, 803, 770, 7879, 2, 69, 777, 2,
+  101, 777, 2, 69, 771, 2, 101, 771, 3, 69, 770, 769, 3, 101, 770, 769,
+  3, 69, 770, 768, 3, 101, 770, 768, 3, 69, 770, 777, 3, 101, 770, 777,
+  3, 69, 770, 771, 3, 101, 770, 771, 3, 69, 803, 770, 3, 101, 803, 770,
+  2, 73, 777, 2, 105, 777, 2, 73, 803, 2, 105, 803, 258, 79, 803, 770,
+  7896, 258, 111, 803, 770, 7897, 2, 79, 777, 2, 111, 777, 3, 79, 770, 769,
+  3, 111, 770, 769, 3, 79, 770, 768, 3, 111, 770, 768, 3, 79, 770, 777,
+  3, 111, 770, 777, 3, 79, 770, 771, 3, 111, 770, 771, 3, 79, 803, 770,
+  3, 111, 803, 770, 3, 79, 795, 769, 3, 111, 795, 769, 3, 79, 795, 768,
+  3, 111, 795, 768, 3, 79, 795, 777, 3, 111, 795, 777, 3, 79, 795, 771,
+  3, 111, 795, 771, 3, 79, 795, 803, 3, 111, 795, 803, 2, 85, 803, 2,
+  117, 803, 2, 85, 777, 2, 117, 777, 3, 85, 795, 769, 3, 117, 795, 769,
+  3, 85, 795, 768, 3, 117, 795, 768, 3, 85, 795, 777, 3, 117, 795, 777,
+  3, 85, 795, 771, 3, 117, 795, 771, 3, 85, 795, 803, 3, 117, 795, 803,
+  2, 89, 768, 2, 121, 768, 2, 89, 803, 2, 121, 803, 2, 89, 777, 2,
+  121, 777, 2, 89, 771, 2, 121, 771, 1026, 945, 787, 768, 7938, 769, 7940, 834,
+  7942, 837, 8064, 1026, 945, 788, 768, 7939, 769, 7941, 834, 7943, 837, 8065, 259, 945,
+  787, 768, 837, 8066, 259, 945, 788, 768, 837, 8067, 259, 945, 787, 769, 837, 8068,
+  259, 945, 788, 769, 837, 8069, 259, 945, 787, 834, 837, 8070, 259, 945, 788, 834,
+  837, 8071, 1026, 913, 787, 768, 7946, 769, 7948, 834, 7950, 837, 8072, 1026, 913, 788,
+  768, 7947, 769, 7949, 834, 7951, 837, 8073, 259, 913, 787, 768, 837, 8074, 259, 913,
+  788, 768, 837, 8075, 259, 913, 787, 769, 837, 8076, 259, 913, 788, 769, 837, 8077,
+  259, 913, 787, 834, 837, 8078, 259, 913, 788, 834, 837, 8079, 514, 949, 787, 768,
+  7954, 769, 7956, 514, 949, 788, 768, 7955, 769, 7957, 3, 949, 787, 768, 3, 949,
+  788, 768, 3, 949, 787, 769, 3, 949, 788, 769, 514, 917, 787, 768, 7962, 769,
+  7964, 514, 917, 788, 768, 7963, 769, 7965, 3, 917, 787, 768, 3, 917, 788, 768,
+  3, 917, 787, 769, 3, 917, 788, 769, 1026, 951, 787, 768, 7970, 769, 7972, 834,
+  7974, 837, 8080, 1026, 951, 788, 768, 7971, 769, 7973, 834, 7975, 837, 8081, 259, 951,
+  787, 768, 837, 8082, 259, 951, 788, 768, 837, 8083, 259, 951, 787, 769, 837, 8084,
+  259, 951, 788, 769, 837, 8085, 259, 951, 787, 834, 837, 8086, 259, 951, 788, 834,
+  837, 8087, 1026, 919, 787, 768, 7978, 769, 7980, 834, 7982, 837, 8088, 1026, 919, 788,
+  768, 7979, 769, 7981, 834, 7983, 837, 8089, 259, 919, 787, 768, 837, 8090, 259, 919,
+  788, 768, 837, 8091, 259, 919, 787, 769, 837, 8092, 259, 919, 788, 769, 837, 8093,
+  259, 919, 787, 834, 837, 8094, 259, 919, 788, 834, 837, 8095, 770, 953, 787, 768,
+  7986, 769, 7988, 834, 7990, 770, 953, 788, 768, 7987, 769, 7989, 834, 7991, 3, 953,
+  787, 768, 3, 953, 788, 768, 3, 953, 787, 769, 3, 953, 788, 769, 3, 953,
+  787, 834, 3, 953, 788, 834, 770, 921, 787, 768, 7994, 769, 7996, 834, 7998, 770,
+  921, 788, 768, 7995, 769, 7997, 834, 7999, 3, 921, 787, 768, 3, 921, 788, 768,
+  3, 921, 787, 769, 3, 921, 788, 769, 3, 921, 787, 834, 3, 921, 788, 834,
+  514, 959, 787, 768, 8002, 769, 8004, 514, 959, 788, 768, 8003, 769, 8005, 3, 959,
+  787, 768, 3, 959, 788, 768, 3, 959, 787, 769, 3, 959, 788, 769, 514, 927,
+  787, 768, 8010, 769, 8012, 514, 927, 788, 768, 8011, 769, 8013, 3, 927, 787, 768,
+  3, 927, 788, 768, 3, 927, 787, 769, 3, 927, 788, 769, 770, 965, 787, 768,
+  8018, 769, 8020, 834, 8022, 770, 965, 788, 768, 8019, 769, 8021, 834, 8023, 3, 965,
+  787, 768, 3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769, 3, 965,
+  787, 834, 3, 965, 788, 834, 770, 933, 788, 768, 8027, 769, 8029, 834, 8031, 3,
+  933, 788, 768, 3, 933, 788, 769, 3, 933, 788, 834, 1026, 969, 787, 768, 8034,
+  769, 8036, 834, 8038, 837, 8096, 1026, 969, 788, 768, 8035, 769, 8037, 834, 8039, 837,
+  8097, 259, 969, 787, 768, 837, 8098, 259, 969, 788, 768, 837, 8099, 259, 969, 787,
+  769, 837, 8100, 259, 969, 788, 769, 837, 8101, 259, 969, 787, 834, 837, 8102, 259,
+  969, 788, 834, 837, 8103, 1026, 937, 787, 768, 8042, 769, 8044, 834, 8046, 837, 8104,
+  1026, 937, 788, 768, 8043, 769, 8045, 834, 8047, 837, 8105, 259, 937, 787, 768, 837,
+  8106, 259, 937, 788, 768, 837, 8107, 259, 937, 787, 769, 837, 8108, 259, 937, 788,
+  769, 837, 8109, 259, 937, 787, 834, 837, 8110, 259, 937, 788, 834, 837, 8111, 258,
+  945, 768, 837, 8114, 2, 945, 769, 2, 949, 768, 2, 949, 769, 258, 951, 768,
+  837, 8130, 2, 951, 769, 2, 953, 768, 2, 953, 769, 2, 959, 768, 2, 959,
+  769, 2, 965, 768, 2, 965, 769, 258, 969, 768, 837, 8178, 2, 969, 769, 3,
+  945, 787, 837, 3, 945, 788, 837, 4, 945, 787, 768, 837, 4, 945, 788, 768,
+  837, 4, 945, 787, 769, 837, 4, 945, 788, 769, 837, 4, 945, 787, 834, 837,
+  4, 945, 788, 834, 837, 3, 913, 787, 837, 3, 913, 788, 837, 4, 913, 787,
+  768, 837, 4, 913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788, 769,
+  837, 4, 913, 787, 834, 837, 4, 913, 788, 834, 837, 3, 951, 787, 837, 3,
+  951, 788, 837, 4, 951, 787, 768, 837, 4, 951, 788, 768, 837, 4, 951, 787,
+  769, 837, 4, 951, 788, 769, 837, 4, 951, 787, 834, 837, 4, 951, 788, 834,
+  837, 3, 919, 787, 837, 3, 919, 788, 837, 4, 919, 787, 768, 837, 4, 919,
+  788, 768, 837, 4, 919, 787, 769, 837, 4, 919, 788, 769, 837, 4, 919, 787,
+  834, 837, 4, 919, 788, 834, 837, 3, 969, 787, 837, 3, 969, 788, 837, 4,
+  969, 787, 768, 837, 4, 969, 788, 768, 837, 4, 969, 787, 769, 837, 4, 969,
+  788, 769, 837, 4, 969, 787, 834, 837, 4, 969, 788, 834, 837, 3, 937, 787,
+  837, 3, 937, 788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837, 4,
+  937, 787, 769, 837, 4, 937, 788, 769, 837, 4, 937, 787, 834, 837, 4, 937,
+  788, 834, 837, 2, 945, 774, 2, 945, 772, 3, 945, 768, 837, 2, 945, 837,
+  3, 945, 769, 837, 258, 945, 834, 837, 8119, 3, 945, 834, 837, 2, 913, 774,
+  2, 913, 772, 2, 913, 768, 2, 913, 769, 2, 913, 837, 1, 953, 784, 32,
+  787, 768, 8141, 769, 8142, 834, 8143, 26, 168, 834, 32, 776, 834, 3, 951, 768,
+  837, 2, 951, 837, 3, 951, 769, 837, 258, 951, 834, 837, 8135, 3, 951, 834,
+  837, 2, 917, 768, 2, 917, 769, 2, 919, 768, 2, 919, 769, 2, 919, 837,
+  26, 8127, 768, 32, 787, 768, 26, 8127, 769, 32, 787, 769, 26, 8127, 834, 32,
+  787, 834, 2, 953, 774, 2, 953, 772, 3, 953, 776, 768, 3, 953, 776, 769,
+  2, 953, 834, 3, 953, 776, 834, 2, 921, 774, 2, 921, 772, 2, 921, 768,
+  2, 921, 769, 26, 8190, 768, 32, 788, 768, 26, 8190, 769, 32, 788, 769, 26,
+  8190, 834, 32, 788, 834, 2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 3,
+  965, 776, 769, 2, 961, 787, 2, 961, 788, 2, 965, 834, 3, 965, 776, 834,
+  2, 933, 774, 2, 933, 772, 2, 933, 768, 2, 933, 769, 2, 929, 788, 26,
+  168, 768, 32, 776, 768, 26, 168, 769, 32, 776, 769, 1, 96, 3, 969, 768,
+  837, 2, 969, 837, 3, 969, 769, 837, 258, 969, 834, 837, 8183, 3, 969, 834,
+  837, 2, 927, 768, 2, 927, 769, 2, 937, 768, 2, 937, 769, 2, 937, 837,
+  17, 180, 32, 769, 784, 32, 788, 768, 8157, 769, 8158, 834, 8159, 9, 8194, 32,
+  9, 8195, 32, 1, 937, 1, 75, 2, 65, 778, 256, 824, 8602, 256, 824, 8603,
+  256, 824, 8622, 2, 8592, 824, 2, 8594, 824, 2, 8596, 824, 2, 8656, 824, 2,
+  8660, 824, 2, 8658, 824, 256, 824, 8653, 256, 824, 8655, 256, 824, 8654, 256, 824,
+  8708, 2, 8707, 824, 256, 824, 8713, 2, 8712, 824, 256, 824, 8716, 2, 8715, 824,
+  256, 824, 8740, 2, 8739, 824, 256, 824, 8742, 2, 8741, 824, 256, 824, 8769, 2,
+  8764, 824, 256, 824, 8772, 2, 8771, 824, 256, 824, 8775, 2, 8773, 824, 256, 824,
+  8777, 2, 8776, 824, 256, 824, 8813, 2, 61, 824, 256, 824, 8802, 2, 8801, 824,
+  256, 824, 8816, 256, 824, 8817, 2, 8781, 824, 2, 60, 824, 2, 62, 824, 2,
+  8804, 824, 2, 8805, 824, 256, 824, 8820, 256, 824, 8821, 2, 8818, 824, 2, 8819,
+  824, 256, 824, 8824, 256, 824, 8825, 2, 8822, 824, 2, 8823, 824, 256, 824, 8832,
+  256, 824, 8833, 256, 824, 8928, 256, 824, 8929, 2, 8826, 824, 2, 8827, 824, 256,
+  824, 8836, 256, 824, 8837, 2, 8834, 824, 2, 8835, 824, 256, 824, 8840, 256, 824,
+  8841, 2, 8838, 824, 2, 8839, 824, 256, 824, 8930, 256, 824, 8931, 256, 824, 8876,
+  256, 824, 8877, 256, 824, 8878, 256, 824, 8879, 2, 8866, 824, 2, 8872, 824, 2,
+  8873, 824, 2, 8875, 824, 256, 824, 8938, 256, 824, 8939, 256, 824, 8940, 256, 824,
+  8941, 2, 8828, 824, 2, 8829, 824, 2, 8849, 824, 2, 8850, 824, 2, 8882, 824,
+  2, 8883, 824, 2, 8884, 824, 2, 8885, 824, 1, 12296, 1, 12297, 2, 10973, 824,
+  256, 12441, 12436, 256, 12441, 12364, 2, 12363, 12441, 256, 12441, 12366, 2, 12365, 12441, 256,
+  12441, 12368, 2, 12367, 12441, 256, 12441, 12370, 2, 12369, 12441, 256, 12441, 12372, 2, 12371,
+  12441, 256, 12441, 12374, 2, 12373, 12441, 256, 12441, 12376, 2, 12375, 12441, 256, 12441, 12378,
+  2, 12377, 12441, 256, 12441, 12380, 2, 12379, 12441, 256, 12441, 12382, 2, 12381, 12441, 256,
+  12441, 12384, 2, 12383, 12441, 256, 12441, 12386, 2, 12385, 12441, 256, 12441, 12389, 2, 12388,
+  12441, 256, 12441, 12391, 2, 12390, 12441, 256, 12441, 12393, 2, 12392, 12441, 512, 12441, 12400,
+  12442, 12401, 2, 12399, 12441, 2, 12399, 12442, 512, 12441, 12403, 12442, 12404, 2, 12402, 12441,
+  2, 12402, 12442, 512, 12441, 12406, 12442, 12407, 2, 12405, 12441, 2, 12405, 12442, 512, 12441,
+  12409, 12442, 12410, 2, 12408, 12441, 2, 12408, 12442, 512, 12441, 12412, 12442, 12413, 2, 12411,
+  12441, 2, 12411, 12442, 2, 12358, 12441, 256, 12441, 12446, 2, 12445, 12441, 256, 12441, 12532,
+  256, 12441, 12460, 2, 12459, 12441, 256, 12441, 12462, 2, 12461, 12441, 256, 12441, 12464, 2,
+  12463, 12441, 256, 12441, 12466, 2, 12465, 12441, 256, 12441, 12468, 2, 12467, 12441, 256, 12441,
+  12470, 2, 12469, 12441, 256, 12441, 12472, 2, 12471, 12441, 256, 12441, 12474, 2, 12473, 12441,
+  256, 12441, 12476, 2, 12475, 12441, 256, 12441, 12478, 2, 12477, 12441, 256, 12441, 12480, 2,
+  12479, 12441, 256, 12441, 12482, 2, 12481, 12441, 256, 12441, 12485, 2, 12484, 12441, 256, 12441,
+  12487, 2, 12486, 12441, 256, 12441, 12489, 2, 12488, 12441, 512, 12441, 12496, 12442, 12497, 2,
+  12495, 12441, 2, 12495, 12442, 512, 12441, 12499, 12442, 12500, 2, 12498, 12441, 2, 12498, 12442,
+  512, 12441, 12502, 12442, 12503, 2, 12501, 12441, 2, 12501, 12442, 512, 12441, 12505, 12442, 12506,
+  2, 12504, 12441, 2, 12504, 12442, 512, 12441, 12508, 12442, 12509, 2, 12507, 12441, 2, 12507,
+  12442, 256, 12441, 12535, 256, 12441, 12536, 256, 12441, 12537, 256, 12441, 12538, 2, 12454, 12441,
+  2, 12527, 12441, 2, 12528, 12441, 2, 12529, 12441, 2, 12530, 12441, 256, 12441, 12542, 2,
+  12541, 12441, 1, 35912, 1, 26356, 1, 36554, 1, 36040, 1, 28369, 1, 20018, 1, 21477,
+  1, 40860, 1, 40860, 1, 22865, 1, 37329, 1, 21895, 1, 22856, 1, 25078, 1, 30313,
+  1, 32645, 1, 34367, 1, 34746, 1, 35064, 1, 37007, 1, 27138, 1, 27931, 1, 28889,
+  1, 29662, 1, 33853, 1, 37226, 1, 39409, 1, 20098, 1, 21365, 1, 27396, 1, 29211,
+  1, 34349, 1, 40478, 1, 23888, 1, 28651, 1, 34253, 1, 35172, 1, 25289, 1, 33240,
+  1, 34847, 1, 24266, 1, 26391, 1, 28010, 1, 29436, 1, 37070, 1, 20358, 1, 20919,
+  1, 21214, 1, 25796, 1, 27347, 1, 29200, 1, 30439, 1, 32769, 1, 34310, 1, 34396,
+  1, 36335, 1, 38706, 1, 39791, 1, 40442, 1, 30860, 1, 31103, 1, 32160, 1, 33737,
+  1, 37636, 1, 40575, 1, 35542, 1, 22751, 1, 24324, 1, 31840, 1, 32894, 1, 29282,
+  1, 30922, 1, 36034, 1, 38647, 1, 22744, 1, 23650, 1, 27155, 1, 28122, 1, 28431,
+  1, 32047, 1, 32311, 1, 38475, 1, 21202, 1, 32907, 1, 20956, 1, 20940, 1, 31260,
+  1, 32190, 1, 33777, 1, 38517, 1, 35712, 1, 25295, 1, 27138, 1, 35582, 1, 20025,
+  1, 23527, 1, 24594, 1, 29575, 1, 30064, 1, 21271, 1, 30971, 1, 20415, 1, 24489,
+  1, 19981, 1, 27852, 1, 25976, 1, 32034, 1, 21443, 1, 22622, 1, 30465, 1, 33865,
+  1, 35498, 1, 27578, 1, 36784, 1, 27784, 1, 25342, 1, 33509, 1, 25504, 1, 30053,
+  1, 20142, 1, 20841, 1, 20937, 1, 26753, 1, 31975, 1, 33391, 1, 35538, 1, 37327,
+  1, 21237, 1, 21570, 1, 22899, 1, 24300, 1, 26053, 1, 28670, 1, 31018, 1, 38317,
+  1, 39530, 1, 40599, 1, 40654, 1, 21147, 1, 26310, 1, 27511, 1, 36706, 1, 24180,
+  1, 24976, 1, 25088, 1, 25754, 1, 28451, 1, 29001, 1, 29833, 1, 31178, 1, 32244,
+  1, 32879, 1, 36646, 1, 34030, 1, 36899, 1, 37706, 1, 21015, 1, 21155, 1, 21693,
+  1, 28872, 1, 35010, 1, 35498, 1, 24265, 1, 24565, 1, 25467, 1, 27566, 1, 31806,
+  1, 29557, 1, 20196, 1, 22265, 1, 23527, 1, 23994, 1, 24604, 1, 29618, 1, 29801,
+  1, 32666, 1, 32838, 1, 37428, 1, 38646, 1, 38728, 1, 38936, 1, 20363, 1, 31150,
+  1, 37300, 1, 38584, 1, 24801, 1, 20102, 1, 20698, 1, 23534, 1, 23615, 1, 26009,
+  1, 27138, 1, 29134, 1, 30274, 1, 34044, 1, 36988, 1, 40845, 1, 26248, 1, 38446,
+  1, 21129, 1, 26491, 1, 26611, 1, 27969, 1, 28316, 1, 29705, 1, 30041, 1, 30827,
+  1, 32016, 1, 39006, 1, 20845, 1, 25134, 1, 38520, 1, 20523, 1, 23833, 1, 28138,
+  1, 36650, 1, 24459, 1, 24900, 1, 26647, 1, 29575, 1, 38534, 1, 21033, 1, 21519,
+  1, 23653, 1, 26131, 1, 26446, 1, 26792, 1, 27877, 1, 29702, 1, 30178, 1, 32633,
+  1, 35023, 1, 35041, 1, 37324, 1, 38626, 1, 21311, 1, 28346, 1, 21533, 1, 29136,
+  1, 29848, 1, 34298, 1, 38563, 1, 40023, 1, 40607, 1, 26519, 1, 28107, 1, 33256,
+  1, 31435, 1, 31520, 1, 31890, 1, 29376, 1, 28825, 1, 35672, 1, 20160, 1, 33590,
+  1, 21050, 1, 20999, 1, 24230, 1, 25299, 1, 31958, 1, 23429, 1, 27934, 1, 26292,
+  1, 36667, 1, 34892, 1, 38477, 1, 35211, 1, 24275, 1, 20800, 1, 21952, 1, 22618,
+  1, 26228, 1, 20958, 1, 29482, 1, 30410, 1, 31036, 1, 31070, 1, 31077, 1, 31119,
+  1, 38742, 1, 31934, 1, 32701, 1, 34322, 1, 35576, 1, 36920, 1, 37117, 1, 39151,
+  1, 39164, 1, 39208, 1, 40372, 1, 37086, 1, 38583, 1, 20398, 1, 20711, 1, 20813,
+  1, 21193, 1, 21220, 1, 21329, 1, 21917, 1, 22022, 1, 22120, 1, 22592, 1, 22696,
+  1, 23652, 1, 23662, 1, 24724, 1, 24936, 1, 24974, 1, 25074, 1, 25935, 1, 26082,
+  1, 26257, 1, 26757, 1, 28023, 1, 28186, 1, 28450, 1, 29038, 1, 29227, 1, 29730,
+  1, 30865, 1, 31038, 1, 31049, 1, 31048, 1, 31056, 1, 31062, 1, 31069, 1, 31117,
+  1, 31118, 1, 31296, 1, 31361, 1, 31680, 1, 32244, 1, 32265, 1, 32321, 1, 32626,
+  1, 32773, 1, 33261, 1, 33401, 1, 33401, 1, 33879, 1, 35088, 1, 35222, 1, 35585,
+  1, 35641, 1, 36051, 1, 36104, 1, 36790, 1, 36920, 1, 38627, 1, 38911, 1, 38971,
+  1, 24693, 1, 148206, 1, 33304, 1, 20006, 1, 20917, 1, 20840, 1, 20352, 1, 20805,
+  1, 20864, 1, 21191, 1, 21242, 1, 21917, 1, 21845, 1, 21913, 1, 21986, 1, 22618,
+  1, 22707, 1, 22852, 1, 22868, 1, 23138, 1, 23336, 1, 24274, 1, 24281, 1, 24425,
+  1, 24493, 1, 24792, 1, 24910, 1, 24840, 1, 24974, 1, 24928, 1, 25074, 1, 25140,
+  1, 25540, 1, 25628, 1, 25682, 1, 25942, 1, 26228, 1, 26391, 1, 26395, 1, 26454,
+  1, 27513, 1, 27578, 1, 27969, 1, 28379, 1, 28363, 1, 28450, 1, 28702, 1, 29038,
+  1, 30631, 1, 29237, 1, 29359, 1, 29482, 1, 29809, 1, 29958, 1, 30011, 1, 30237,
+  1, 30239, 1, 30410, 1, 30427, 1, 30452, 1, 30538, 1, 30528, 1, 30924, 1, 31409,
+  1, 31680, 1, 31867, 1, 32091, 1, 32244, 1, 32574, 1, 32773, 1, 33618, 1, 33775,
+  1, 34681, 1, 35137, 1, 35206, 1, 35222, 1, 35519, 1, 35576, 1, 35531, 1, 35585,
+  1, 35582, 1, 35565, 1, 35641, 1, 35722, 1, 36104, 1, 36664, 1, 36978, 1, 37273,
+  1, 37494, 1, 38524, 1, 38627, 1, 38742, 1, 38875, 1, 38911, 1, 38923, 1, 38971,
+  1, 39698, 1, 40860, 1, 141386, 1, 141380, 1, 144341, 1, 15261, 1, 16408, 1, 16441,
+  1, 152137, 1, 154832, 1, 163539, 1, 40771, 1, 40846, 2, 1497, 1460, 2, 1522, 1463,
+  2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468, 1473, 3, 1513, 1468, 1474, 2, 1488,
+  1463, 2, 1488, 1464, 2, 1488, 1468, 2, 1489, 1468, 2, 1490, 1468, 2, 1491, 1468,
+  2, 1492, 1468, 2, 1493, 1468, 2, 1494, 1468, 2, 1496, 1468, 2, 1497, 1468, 2,
+  1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2, 1502, 1468, 2, 1504, 1468, 2, 1505,
+  1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510, 1468, 2, 1511, 1468, 2, 1512, 1468,
+  2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465, 2, 1489, 1471, 2, 1499, 1471, 2,
+  1508, 1471, 256, 69818, 69786, 2, 69785, 69818, 256, 69818, 69788, 2, 69787, 69818, 256, 69818,
+  69803, 2, 69797, 69818, 2, 69937, 69927, 2, 69938, 69927, 256, 69927, 69934, 256, 69927, 69935,
+  512, 70462, 70475, 70487, 70476, 2, 70471, 70462, 2, 70471, 70487, 768, 70832, 70844, 70842, 70843,
+  70845, 70846, 2, 70841, 70842, 2, 70841, 70832, 2, 70841, 70845, 256, 71087, 71098, 256, 71087,
+  71099, 2, 71096, 71087, 2, 71097, 71087, 256, 71984, 71992, 2, 71989, 71984, 2, 119127, 119141,
+  2, 119128, 119141, 3, 119128, 119141, 119150, 3, 119128, 119141, 119151, 3, 119128, 119141, 119152, 3,
+  119128, 119141, 119153, 3, 119128, 119141, 119154, 2, 119225, 119141, 2, 119226, 119141, 3, 119225, 119141,
+  119150, 3, 119226, 119141, 119150, 3, 119225, 119141, 119151, 3, 119226, 119141, 119151, 1, 20029, 1,
+  20024, 1, 20033, 1, 131362, 1, 20320, 1, 20398, 1, 20411, 1, 20482, 1, 20602, 1,
+  20633, 1, 20711, 1, 20687, 1, 13470, 1, 132666, 1, 20813, 1, 20820, 1, 20836, 1,
+  20855, 1, 132380, 1, 13497, 1, 20839, 1, 20877, 1, 132427, 1, 20887, 1, 20900, 1,
+  20172, 1, 20908, 1, 20917, 1, 168415, 1, 20981, 1, 20995, 1, 13535, 1, 21051, 1,
+  21062, 1, 21106, 1, 21111, 1, 13589, 1, 21191, 1, 21193, 1, 21220, 1, 21242, 1,
+  21253, 1, 21254, 1, 21271, 1, 21321, 1, 21329, 1, 21338, 1, 21363, 1, 21373, 1,
+  21375, 1, 21375, 1, 21375, 1, 133676, 1, 28784, 1, 21450, 1, 21471, 1, 133987, 1,
+  21483, 1, 21489, 1, 21510, 1, 21662, 1, 21560, 1, 21576, 1, 21608, 1, 21666, 1,
+  21750, 1, 21776, 1, 21843, 1, 21859, 1, 21892, 1, 21892, 1, 21913, 1, 21931, 1,
+  21939, 1, 21954, 1, 22294, 1, 22022, 1, 22295, 1, 22097, 1, 22132, 1, 20999, 1,
+  22766, 1, 22478, 1, 22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577, 1, 22700, 1,
+  136420, 1, 22770, 1, 22775, 1, 22790, 1, 22810, 1, 22818, 1, 22882, 1, 136872, 1,
+  136938, 1, 23020, 1, 23067, 1, 23079, 1, 23000, 1, 23142, 1, 14062, 1, 14076, 1,
+  23304, 1, 23358, 1, 23358, 1, 137672, 1, 23491, 1, 23512, 1, 23527, 1, 23539, 1,
+  138008, 1, 23551, 1, 23558, 1, 24403, 1, 23586, 1, 14209, 1, 23648, 1, 23662, 1,
+  23744, 1, 23693, 1, 138724, 1, 23875, 1, 138726, 1, 23918, 1, 23915, 1, 23932, 1,
+  24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1, 24125, 1, 24169, 1, 14434, 1,
+  139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1, 24266, 1, 172946, 1, 24318, 1,
+  140081, 1, 140081, 1, 33281, 1, 24354, 1, 24354, 1, 14535, 1, 144056, 1, 156122, 1,
+  24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1, 24569, 1, 24705, 1,
+  14650, 1, 14620, 1, 24724, 1, 141012, 1, 24775, 1, 24904, 1, 24908, 1, 24910, 1,
+  24908, 1, 24954, 1, 24974, 1, 25010, 1, 24996, 1, 25007, 1, 25054, 1, 25074, 1,
+  25078, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1, 25424, 1, 142092, 1,
+  25405, 1, 25340, 1, 25448, 1, 25475, 1, 25572, 1, 142321, 1, 25634, 1, 25541, 1,
+  25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1, 25719, 1, 14956, 1, 25935, 1,
+  25964, 1, 143370, 1, 26083, 1, 26360, 1, 26185, 1, 15129, 1, 26257, 1, 15112, 1,
+  15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1, 32941, 1, 17369, 1, 26391, 1,
+  26395, 1, 26401, 1, 26462, 1, 26451, 1, 144323, 1, 15177, 1, 26618, 1, 26501, 1,
+  26706, 1, 26757, 1, 144493, 1, 26766, 1, 26655, 1, 26900, 1, 15261, 1, 26946, 1,
+  27043, 1, 27114, 1, 27304, 1, 145059, 1, 27355, 1, 15384, 1, 27425, 1, 145575, 1,
+  27476, 1, 15438, 1, 27506, 1, 27551, 1, 27578, 1, 27579, 1, 146061, 1, 138507, 1,
+  146170, 1, 27726, 1, 146620, 1, 27839, 1, 27853, 1, 27751, 1, 27926, 1, 27966, 1,
+  28023, 1, 27969, 1, 28009, 1, 28024, 1, 28037, 1, 146718, 1, 27956, 1, 28207, 1,
+  28270, 1, 15667, 1, 28363, 1, 28359, 1, 147153, 1, 28153, 1, 28526, 1, 147294, 1,
+  147342, 1, 28614, 1, 28729, 1, 28702, 1, 28699, 1, 15766, 1, 28746, 1, 28797, 1,
+  28791, 1, 28845, 1, 132389, 1, 28997, 1, 148067, 1, 29084, 1, 148395, 1, 29224, 1,
+  29237, 1, 29264, 1, 149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524, 1, 29562, 1,
+  29579, 1, 16044, 1, 29605, 1, 16056, 1, 16056, 1, 29767, 1, 29788, 1, 29809, 1,
+  29829, 1, 29898, 1, 16155, 1, 29988, 1, 150582, 1, 30014, 1, 150674, 1, 30064, 1,
+  139679, 1, 30224, 1, 151457, 1, 151480, 1, 151620, 1, 16380, 1, 16392, 1, 30452, 1,
+  151795, 1, 151794, 1, 151833, 1, 151859, 1, 30494, 1, 30495, 1, 30495, 1, 30538, 1,
+  16441, 1, 30603, 1, 16454, 1, 16534, 1, 152605, 1, 30798, 1, 30860, 1, 30924, 1,
+  16611, 1, 153126, 1, 31062, 1, 153242, 1, 153285, 1, 31119, 1, 31211, 1, 16687, 1,
+  31296, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 154279, 1, 31470, 1, 16898, 1,
+  154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1, 31954, 1, 17056, 1, 31976, 1,
+  31971, 1, 32000, 1, 155526, 1, 32099, 1, 17153, 1, 32199, 1, 32258, 1, 32325, 1,
+  17204, 1, 156200, 1, 156231, 1, 17241, 1, 156377, 1, 32634, 1, 156478, 1, 32661, 1,
+  32762, 1, 32773, 1, 156890, 1, 156963, 1, 32864, 1, 157096, 1, 32880, 1, 144223, 1,
+  17365, 1, 32946, 1, 33027, 1, 17419, 1, 33086, 1, 23221, 1, 157607, 1, 157621, 1,
+  144275, 1, 144284, 1, 33281, 1, 33284, 1, 36766, 1, 17515, 1, 33425, 1, 33419, 1,
+  33437, 1, 21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524, 1, 33509, 1,
+  33565, 1, 33635, 1, 33709, 1, 33571, 1, 33725, 1, 33767, 1, 33879, 1, 33619, 1,
+  33738, 1, 33740, 1, 33756, 1, 158774, 1, 159083, 1, 158933, 1, 17707, 1, 34033, 1,
+  34035, 1, 34070, 1, 160714, 1, 34148, 1, 159532, 1, 17757, 1, 17761, 1, 159665, 1,
+  159954, 1, 17771, 1, 34384, 1, 34396, 1, 34407, 1, 34409, 1, 34473, 1, 34440, 1,
+  34574, 1, 34530, 1, 34681, 1, 34600, 1, 34667, 1, 34694, 1, 17879, 1, 34785, 1,
+  34817, 1, 17913, 1, 34912, 1, 34915, 1, 161383, 1, 35031, 1, 35038, 1, 17973, 1,
+  35066, 1, 13499, 1, 161966, 1, 162150, 1, 18110, 1, 18119, 1, 35488, 1, 35565, 1,
+  35722, 1, 35925, 1, 162984, 1, 36011, 1, 36033, 1, 36123, 1, 36215, 1, 163631, 1,
+  133124, 1, 36299, 1, 36284, 1, 36336, 1, 133342, 1, 36564, 1, 36664, 1, 165330, 1,
+  165357, 1, 37012, 1, 37105, 1, 37137, 1, 165678, 1, 37147, 1, 37432, 1, 37591, 1,
+  37592, 1, 37500, 1, 37881, 1, 37909, 1, 166906, 1, 38283, 1, 18837, 1, 38327, 1,
+  167287, 1, 18918, 1, 38595, 1, 23986, 1, 38691, 1, 168261, 1, 168474, 1, 19054, 1,
+  19062, 1, 38880, 1, 168970, 1, 19122, 1, 169110, 1, 38923, 1, 38923, 1, 38953, 1,
+  169398, 1, 39138, 1, 19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422, 1, 19406, 1,
+  170800, 1, 39698, 1, 40000, 1, 40189, 1, 19662, 1, 19693, 1, 40295, 1, 172238, 1,
+  19704, 1, 172293, 1, 172558, 1, 172689, 1, 40635, 1, 19798, 1, 40697, 1, 40702, 1,
+  40709, 1, 40719, 1, 40726, 1, 40763, 1, 173568, 8, 32, 8, 97, 16, 32, 772,
+  8, 50, 8, 51, 16, 32, 769, 8, 956, 16, 32, 807, 8, 49, 8, 111,
+  24, 49, 8260, 52, 24, 49, 8260, 50, 24, 51, 8260, 52, 16, 73, 74, 16,
+  105, 106, 16, 76, 183, 16, 108, 183, 16, 700, 110, 24, 68, 90, 780, 24,
+  68, 122, 780, 24, 100, 122, 780, 16, 76, 74, 16, 76, 106, 16, 108, 106,
+  16, 78, 74, 16, 78, 106, 16, 110, 106, 16, 68, 90, 16, 68, 122, 16,
+  100, 122, 8, 104, 8, 614, 8, 106, 8, 114, 8, 633, 8, 635, 8, 641,
+  8, 119, 8, 121, 16, 32, 774, 16, 32, 775, 16, 32, 778, 16, 32, 808,
+  16, 32, 771, 16, 32, 779, 8, 611, 8, 108, 8, 115, 8, 120, 8, 661,
+  16, 32, 837, 16, 32, 769, 8, 946, 8, 952, 8, 966, 8, 960, 8, 954,
+  8, 961, 8, 962, 8, 920, 8, 949, 8, 931, 16, 1381, 1410, 16, 1575, 1652,
+  16, 1608, 1652, 16, 1735, 1652, 16, 1610, 1652, 16, 3661, 3634, 16, 3789, 3762, 16,
+  3755, 3737, 16, 3755, 3745, 8, 3851, 24, 4018, 3953, 3968, 24, 4019, 3953, 3968, 8,
+  4316, 8, 65, 8, 198, 8, 66, 8, 68, 8, 69, 8, 398, 8, 71, 8,
+  72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8,
+  546, 8, 80, 8, 82, 8, 84, 8, 85, 8, 87, 8, 97, 8, 592, 8,
+  593, 8, 7426, 8, 98, 8, 100, 8, 101, 8, 601, 8, 603, 8, 604, 8,
+  103, 8, 107, 8, 109, 8, 331, 8, 111, 8, 596, 8, 7446, 8, 7447, 8,
+  112, 8, 116, 8, 117, 8, 7453, 8, 623, 8, 118, 8, 7461, 8, 946, 8,
+  947, 8, 948, 8, 966, 8, 967, 8, 105, 8, 114, 8, 117, 8, 118, 8,
+  946, 8, 947, 8, 961, 8, 966, 8, 967, 8, 1085, 8, 594, 8, 99, 8,
+  597, 8, 240, 8, 604, 8, 102, 8, 607, 8, 609, 8, 613, 8, 616, 8,
+  617, 8, 618, 8, 7547, 8, 669, 8, 621, 8, 7557, 8, 671, 8, 625, 8,
+  624, 8, 626, 8, 627, 8, 628, 8, 629, 8, 632, 8, 642, 8, 643, 8,
+  427, 8, 649, 8, 650, 8, 7452, 8, 651, 8, 652, 8, 122, 8, 656, 8,
+  657, 8, 658, 8, 952, 16, 97, 702, 16, 32, 787, 16, 32, 834, 8, 32,
+  8, 32, 8, 32, 8, 32, 8, 32, 8, 32, 8, 32, 8, 32, 8, 32,
+  8, 8208, 16, 32, 819, 8, 46, 16, 46, 46, 24, 46, 46, 46, 8, 32,
+  16, 8242, 8242, 24, 8242, 8242, 8242, 16, 8245, 8245, 24, 8245, 8245, 8245, 16, 33,
+  33, 16, 32, 773, 16, 63, 63, 16, 63, 33, 16, 33, 63, 32, 8242, 8242,
+  8242, 8242, 8, 32, 8, 48, 8, 105, 8, 52, 8, 53, 8, 54, 8, 55,
+  8, 56, 8, 57, 8, 43, 8, 8722, 8, 61, 8, 40, 8, 41, 8, 110,
+  8, 48, 8, 49, 8, 50, 8, 51, 8, 52, 8, 53, 8, 54, 8, 55,
+  8, 56, 8, 57, 8, 43, 8, 8722, 8, 61, 8, 40, 8, 41, 8, 97,
+  8, 101, 8, 111, 8, 120, 8, 601, 8, 104, 8, 107, 8, 108, 8, 109,
+  8, 110, 8, 112, 8, 115, 8, 116, 16, 82, 115, 24, 97, 47, 99, 24,
+  97, 47, 115, 8, 67, 16, 176, 67, 24, 99, 47, 111, 24, 99, 47, 117,
+  8, 400, 16, 176, 70, 8, 103, 8, 72, 8, 72, 8, 72, 8, 104, 8,
+  295, 8, 73, 8, 73, 8, 76, 8, 108, 8, 78, 16, 78, 111, 8, 80,
+  8, 81, 8, 82, 8, 82, 8, 82, 16, 83, 77, 24, 84, 69, 76, 16,
+  84, 77, 8, 90, 8, 90, 8, 66, 8, 67, 8, 101, 8, 69, 8, 70,
+  8, 77, 8, 111, 8, 1488, 8, 1489, 8, 1490, 8, 1491, 8, 105, 24, 70,
+  65, 88, 8, 960, 8, 947, 8, 915, 8, 928, 8, 8721, 8, 68, 8, 100,
+  8, 101, 8, 105, 8, 106, 24, 49, 8260, 55, 24, 49, 8260, 57, 32, 49,
+  8260, 49, 48, 24, 49, 8260, 51, 24, 50, 8260, 51, 24, 49, 8260, 53, 24,
+  50, 8260, 53, 24, 51, 8260, 53, 24, 52, 8260, 53, 24, 49, 8260, 54, 24,
+  53, 8260, 54, 24, 49, 8260, 56, 24, 51, 8260, 56, 24, 53, 8260, 56, 24,
+  55, 8260, 56, 16, 49, 8260, 8, 73, 16, 73, 73, 24, 73, 73, 73, 16,
+  73, 86, 8, 86, 16, 86, 73, 24, 86, 73, 73, 32, 86, 73, 73, 73,
+  16, 73, 88, 8, 88, 16, 88, 73, 24, 88, 73, 73, 8, 76, 8, 67,
+  8, 68, 8, 77, 8, 105, 16, 105, 105, 24, 105, 105, 105, 16, 105, 118,
+  8, 118, 16, 118, 105, 24, 118, 105, 105, 32, 118, 105, 105, 105, 16, 105,
+  120, 8, 120, 16, 120, 105, 24, 120, 105, 105, 8, 108, 8, 99, 8, 100,
+  8, 109, 24, 48, 8260, 51, 16, 8747, 8747, 24, 8747, 8747, 8747, 16, 8750, 8750,
+  24, 8750, 8750, 8750, 8, 49, 8, 50, 8, 51, 8, 52, 8, 53, 8, 54,
+  8, 55, 8, 56, 8, 57, 16, 49, 48, 16, 49, 49, 16, 49, 50, 16,
+  49, 51, 16, 49, 52, 16, 49, 53, 16, 49, 54, 16, 49, 55, 16, 49,
+  56, 16, 49, 57, 16, 50, 48, 24, 40, 49, 41, 24, 40, 50, 41, 24,
+  40, 51, 41, 24, 40, 52, 41, 24, 40, 53, 41, 24, 40, 54, 41, 24,
+  40, 55, 41, 24, 40, 56, 41, 24, 40, 57, 41, 32, 40, 49, 48, 41,
+  32, 40, 49, 49, 41, 32, 40, 49, 50, 41, 32, 40, 49, 51, 41, 32,
+  40, 49, 52, 41, 32, 40, 49, 53, 41, 32, 40, 49, 54, 41, 32, 40,
+  49, 55, 41, 32, 40, 49, 56, 41, 32, 40, 49, 57, 41, 32, 40, 50,
+  48, 41, 16, 49, 46, 16, 50, 46, 16, 51, 46, 16, 52, 46, 16, 53,
+  46, 16, 54, 46, 16, 55, 46, 16, 56, 46, 16, 57, 46, 24, 49, 48,
+  46, 24, 49, 49, 46, 24, 49, 50, 46, 24, 49, 51, 46, 24, 49, 52,
+  46, 24, 49, 53, 46, 24, 49, 54, 46, 24, 49, 55, 46, 24, 49, 56,
+  46, 24, 49, 57, 46, 24, 50, 48, 46, 24, 40, 97, 41, 24, 40, 98,
+  41, 24, 40, 99, 41, 24, 40, 100, 41, 24, 40, 101, 41, 24, 40, 102,
+  41, 24, 40, 103, 41, 24, 40, 104, 41, 24, 40, 105, 41, 24, 40, 106,
+  41, 24, 40, 107, 41, 24, 40, 108, 41, 24, 40, 109, 41, 24, 40, 110,
+  41, 24, 40, 111, 41, 24, 40, 112, 41, 24, 40, 113, 41, 24, 40, 114,
+  41, 24, 40, 115, 41, 24, 40, 116, 41, 24, 40, 117, 41, 24, 40, 118,
+  41, 24, 40, 119, 41, 24, 40, 120, 41, 24, 40, 121, 41, 24, 40, 122,
+  41, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8,
+  72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8,
+  80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8,
+  88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8,
+  102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8,
+  110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8,
+  118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 48, 32, 8747, 8747, 8747, 8747,
+  24, 58, 58, 61, 16, 61, 61, 24, 61, 61, 61, 8, 106, 8, 86, 8,
+  11617, 8, 27597, 8, 40863, 8, 19968, 8, 20008, 8, 20022, 8, 20031, 8, 20057, 8,
+  20101, 8, 20108, 8, 20128, 8, 20154, 8, 20799, 8, 20837, 8, 20843, 8, 20866, 8,
+  20886, 8, 20907, 8, 20960, 8, 20981, 8, 20992, 8, 21147, 8, 21241, 8, 21269, 8,
+  21274, 8, 21304, 8, 21313, 8, 21340, 8, 21353, 8, 21378, 8, 21430, 8, 21448, 8,
+  21475, 8, 22231, 8, 22303, 8, 22763, 8, 22786, 8, 22794, 8, 22805, 8, 22823, 8,
+  22899, 8, 23376, 8, 23424, 8, 23544, 8, 23567, 8, 23586, 8, 23608, 8, 23662, 8,
+  23665, 8, 24027, 8, 24037, 8, 24049, 8, 24062, 8, 24178, 8, 24186, 8, 24191, 8,
+  24308, 8, 24318, 8, 24331, 8, 24339, 8, 24400, 8, 24417, 8, 24435, 8, 24515, 8,
+  25096, 8, 25142, 8, 25163, 8, 25903, 8, 25908, 8, 25991, 8, 26007, 8, 26020, 8,
+  26041, 8, 26080, 8, 26085, 8, 26352, 8, 26376, 8, 26408, 8, 27424, 8, 27490, 8,
+  27513, 8, 27571, 8, 27595, 8, 27604, 8, 27611, 8, 27663, 8, 27668, 8, 27700, 8,
+  28779, 8, 29226, 8, 29238, 8, 29243, 8, 29247, 8, 29255, 8, 29273, 8, 29275, 8,
+  29356, 8, 29572, 8, 29577, 8, 29916, 8, 29926, 8, 29976, 8, 29983, 8, 29992, 8,
+  30000, 8, 30091, 8, 30098, 8, 30326, 8, 30333, 8, 30382, 8, 30399, 8, 30446, 8,
+  30683, 8, 30690, 8, 30707, 8, 31034, 8, 31160, 8, 31166, 8, 31348, 8, 31435, 8,
+  31481, 8, 31859, 8, 31992, 8, 32566, 8, 32593, 8, 32650, 8, 32701, 8, 32769, 8,
+  32780, 8, 32786, 8, 32819, 8, 32895, 8, 32905, 8, 33251, 8, 33258, 8, 33267, 8,
+  33276, 8, 33292, 8, 33307, 8, 33311, 8, 33390, 8, 33394, 8, 33400, 8, 34381, 8,
+  34411, 8, 34880, 8, 34892, 8, 34915, 8, 35198, 8, 35211, 8, 35282, 8, 35328, 8,
+  35895, 8, 35910, 8, 35925, 8, 35960, 8, 35997, 8, 36196, 8, 36208, 8, 36275, 8,
+  36523, 8, 36554, 8, 36763, 8, 36784, 8, 36789, 8, 37009, 8, 37193, 8, 37318, 8,
+  37324, 8, 37329, 8, 38263, 8, 38272, 8, 38428, 8, 38582, 8, 38585, 8, 38632, 8,
+  38737, 8, 38750, 8, 38754, 8, 38761, 8, 38859, 8, 38893, 8, 38899, 8, 38913, 8,
+  39080, 8, 39131, 8, 39135, 8, 39318, 8, 39321, 8, 39340, 8, 39592, 8, 39640, 8,
+  39647, 8, 39717, 8, 39727, 8, 39730, 8, 39740, 8, 39770, 8, 40165, 8, 40565, 8,
+  40575, 8, 40613, 8, 40635, 8, 40643, 8, 40653, 8, 40657, 8, 40697, 8, 40701, 8,
+  40718, 8, 40723, 8, 40736, 8, 40763, 8, 40778, 8, 40786, 8, 40845, 8, 40860, 8,
+  40864, 8, 32, 8, 12306, 8, 21313, 8, 21316, 8, 21317, 16, 32, 12441, 16, 32,
+  12442, 16, 12424, 12426, 16, 12467, 12488, 8, 4352, 8, 4353, 8, 4522, 8, 4354, 8,
+  4524, 8, 4525, 8, 4355, 8, 4356, 8, 4357, 8, 4528, 8, 4529, 8, 4530, 8,
+  4531, 8, 4532, 8, 4533, 8, 4378, 8, 4358, 8, 4359, 8, 4360, 8, 4385, 8,
+  4361, 8, 4362, 8, 4363, 8, 4364, 8, 4365, 8, 4366, 8, 4367, 8, 4368, 8,
+  4369, 8, 4370, 8, 4449, 8, 4450, 8, 4451, 8, 4452, 8, 4453, 8, 4454, 8,
+  4455, 8, 4456, 8, 4457, 8, 4458, 8, 4459, 8, 4460, 8, 4461, 8, 4462, 8,
+  4463, 8, 4464, 8, 4465, 8, 4466, 8, 4467, 8, 4468, 8, 4469, 8, 4448, 8,
+  4372, 8, 4373, 8, 4551, 8, 4552, 8, 4556, 8, 4558, 8, 4563, 8, 4567, 8,
+  4569, 8, 4380, 8, 4573, 8, 4575, 8, 4381, 8, 4382, 8, 4384, 8, 4386, 8,
+  4387, 8, 4391, 8, 4393, 8, 4395, 8, 4396, 8, 4397, 8, 4398, 8, 4399, 8,
+  4402, 8, 4406, 8, 4416, 8, 4423, 8, 4428, 8, 4593, 8, 4594, 8, 4439, 8,
+  4440, 8, 4441, 8, 4484, 8, 4485, 8, 4488, 8, 4497, 8, 4498, 8, 4500, 8,
+  4510, 8, 4513, 8, 19968, 8, 20108, 8, 19977, 8, 22235, 8, 19978, 8, 20013, 8,
+  19979, 8, 30002, 8, 20057, 8, 19993, 8, 19969, 8, 22825, 8, 22320, 8, 20154, 24,
+  40, 4352, 41, 24, 40, 4354, 41, 24, 40, 4355, 41, 24, 40, 4357, 41, 24,
+  40, 4358, 41, 24, 40, 4359, 41, 24, 40, 4361, 41, 24, 40, 4363, 41, 24,
+  40, 4364, 41, 24, 40, 4366, 41, 24, 40, 4367, 41, 24, 40, 4368, 41, 24,
+  40, 4369, 41, 24, 40, 4370, 41, 32, 40, 4352, 4449, 41, 32, 40, 4354, 4449,
+  41, 32, 40, 4355, 4449, 41, 32, 40, 4357, 4449, 41, 32, 40, 4358, 4449, 41,
+  32, 40, 4359, 4449, 41, 32, 40, 4361, 4449, 41, 32, 40, 4363, 4449, 41, 32,
+  40, 4364, 4449, 41, 32, 40, 4366, 4449, 41, 32, 40, 4367, 4449, 41, 32, 40,
+  4368, 4449, 41, 32, 40, 4369, 4449, 41, 32, 40, 4370, 4449, 41, 32, 40, 4364,
+  4462, 41, 56, 40, 4363, 4457, 4364, 4453, 4523, 41, 48, 40, 4363, 4457, 4370, 4462,
+  41, 24, 40, 19968, 41, 24, 40, 20108, 41, 24, 40, 19977, 41, 24, 40, 22235,
+  41, 24, 40, 20116, 41, 24, 40, 20845, 41, 24, 40, 19971, 41, 24, 40, 20843,
+  41, 24, 40, 20061, 41, 24, 40, 21313, 41, 24, 40, 26376, 41, 24, 40, 28779,
+  41, 24, 40, 27700, 41, 24, 40, 26408, 41, 24, 40, 37329, 41, 24, 40, 22303,
+  41, 24, 40, 26085, 41, 24, 40, 26666, 41, 24, 40, 26377, 41, 24, 40, 31038,
+  41, 24, 40, 21517, 41, 24, 40, 29305, 41, 24, 40, 36001, 41, 24, 40, 31069,
+  41, 24, 40, 21172, 41, 24, 40, 20195, 41, 24, 40, 21628, 41, 24, 40, 23398,
+  41, 24, 40, 30435, 41, 24, 40, 20225, 41, 24, 40, 36039, 41, 24, 40, 21332,
+  41, 24, 40, 31085, 41, 24, 40, 20241, 41, 24, 40, 33258, 41, 24, 40, 33267,
+  41, 8, 21839, 8, 24188, 8, 25991, 8, 31631, 24, 80, 84, 69, 16, 50, 49,
+  16, 50, 50, 16, 50, 51, 16, 50, 52, 16, 50, 53, 16, 50, 54, 16,
+  50, 55, 16, 50, 56, 16, 50, 57, 16, 51, 48, 16, 51, 49, 16, 51,
+  50, 16, 51, 51, 16, 51, 52, 16, 51, 53, 8, 4352, 8, 4354, 8, 4355,
+  8, 4357, 8, 4358, 8, 4359, 8, 4361, 8, 4363, 8, 4364, 8, 4366, 8, 4367,
+  8, 4368, 8, 4369, 8, 4370, 16, 4352, 4449, 16, 4354, 4449, 16, 4355, 4449, 16,
+  4357, 4449, 16, 4358, 4449, 16, 4359, 4449, 16, 4361, 4449, 16, 4363, 4449, 16, 4364,
+  4449, 16, 4366, 4449, 16, 4367, 4449, 16, 4368, 4449, 16, 4369, 4449, 16, 4370, 4449,
+  40, 4366, 4449, 4535, 4352, 4457, 32, 4364, 4462, 4363, 4468, 16, 4363, 4462, 8, 19968,
+  8, 20108, 8, 19977, 8, 22235, 8, 20116, 8, 20845, 8, 19971, 8, 20843, 8, 20061,
+  8, 21313, 8, 26376, 8, 28779, 8, 27700, 8, 26408, 8, 37329, 8, 22303, 8, 26085,
+  8, 26666, 8, 26377, 8, 31038, 8, 21517, 8, 29305, 8, 36001, 8, 31069, 8, 21172,
+  8, 31192, 8, 30007, 8, 22899, 8, 36969, 8, 20778, 8, 21360, 8, 27880, 8, 38917,
+  8, 20241, 8, 20889, 8, 27491, 8, 19978, 8, 20013, 8, 19979, 8, 24038, 8, 21491,
+  8, 21307, 8, 23447, 8, 23398, 8, 30435, 8, 20225, 8, 36039, 8, 21332, 8, 22812,
+  16, 51, 54, 16, 51, 55, 16, 51, 56, 16, 51, 57, 16, 52, 48, 16,
+  52, 49, 16, 52, 50, 16, 52, 51, 16, 52, 52, 16, 52, 53, 16, 52,
+  54, 16, 52, 55, 16, 52, 56, 16, 52, 57, 16, 53, 48, 16, 49, 26376,
+  16, 50, 26376, 16, 51, 26376, 16, 52, 26376, 16, 53, 26376, 16, 54, 26376, 16,
+  55, 26376, 16, 56, 26376, 16, 57, 26376, 24, 49, 48, 26376, 24, 49, 49, 26376,
+  24, 49, 50, 26376, 16, 72, 103, 24, 101, 114, 103, 16, 101, 86, 24, 76,
+  84, 68, 8, 12450, 8, 12452, 8, 12454, 8, 12456, 8, 12458, 8, 12459, 8, 12461,
+  8, 12463, 8, 12465, 8, 12467, 8, 12469, 8, 12471, 8, 12473, 8, 12475, 8, 12477,
+  8, 12479, 8, 12481, 8, 12484, 8, 12486, 8, 12488, 8, 12490, 8, 12491, 8, 12492,
+  8, 12493, 8, 12494, 8, 12495, 8, 12498, 8, 12501, 8, 12504, 8, 12507, 8, 12510,
+  8, 12511, 8, 12512, 8, 12513, 8, 12514, 8, 12516, 8, 12518, 8, 12520, 8, 12521,
+  8, 12522, 8, 12523, 8, 12524, 8, 12525, 8, 12527, 8, 12528, 8, 12529, 8, 12530,
+  16, 20196, 21644, 40, 12450, 12495, 12442, 12540, 12488, 32, 12450, 12523, 12501, 12449, 40, 12450,
+  12531, 12504, 12442, 12450, 24, 12450, 12540, 12523, 40, 12452, 12491, 12531, 12463, 12441, 24, 12452,
+  12531, 12481, 24, 12454, 12457, 12531, 48, 12456, 12473, 12463, 12540, 12488, 12441, 32, 12456, 12540,
+  12459, 12540, 24, 12458, 12531, 12473, 24, 12458, 12540, 12512, 24, 12459, 12452, 12522, 32, 12459,
+  12521, 12483, 12488, 32, 12459, 12525, 12522, 12540, 32, 12459, 12441, 12525, 12531, 32, 12459, 12441,
+  12531, 12510, 32, 12461, 12441, 12459, 12441, 32, 12461, 12441, 12491, 12540, 32, 12461, 12517, 12522,
+  12540, 48, 12461, 12441, 12523, 12479, 12441, 12540, 16, 12461, 12525, 48, 12461, 12525, 12463, 12441,
+  12521, 12512, 48, 12461, 12525, 12513, 12540, 12488, 12523, 40, 12461, 12525, 12527, 12483, 12488, 32,
+  12463, 12441, 12521, 12512, 48, 12463, 12441, 12521, 12512, 12488, 12531, 48, 12463, 12523, 12475, 12441,
+  12452, 12525, 32, 12463, 12525, 12540, 12493, 24, 12465, 12540, 12473, 24, 12467, 12523, 12490, 32,
+  12467, 12540, 12507, 12442, 32, 12469, 12452, 12463, 12523, 40, 12469, 12531, 12481, 12540, 12512, 40,
+  12471, 12522, 12531, 12463, 12441, 24, 12475, 12531, 12481, 24, 12475, 12531, 12488, 32, 12479, 12441,
+  12540, 12473, 24, 12486, 12441, 12471, 24, 12488, 12441, 12523, 16, 12488, 12531, 16, 12490, 12494,
+  24, 12494, 12483, 12488, 24, 12495, 12452, 12484, 48, 12495, 12442, 12540, 12475, 12531, 12488, 32,
+  12495, 12442, 12540, 12484, 40, 12495, 12441, 12540, 12524, 12523, 48, 12498, 12442, 12450, 12473, 12488,
+  12523, 32, 12498, 12442, 12463, 12523, 24, 12498, 12442, 12467, 24, 12498, 12441, 12523, 48, 12501,
+  12449, 12521, 12483, 12488, 12441, 32, 12501, 12451, 12540, 12488, 48, 12501, 12441, 12483, 12471, 12455,
+  12523, 24, 12501, 12521, 12531, 40, 12504, 12463, 12479, 12540, 12523, 24, 12504, 12442, 12477, 32,
+  12504, 12442, 12491, 12498, 24, 12504, 12523, 12484, 32, 12504, 12442, 12531, 12473, 40, 12504, 12442,
+  12540, 12471, 12441, 32, 12504, 12441, 12540, 12479, 40, 12507, 12442, 12452, 12531, 12488, 32, 12507,
+  12441, 12523, 12488, 16, 12507, 12531, 40, 12507, 12442, 12531, 12488, 12441, 24, 12507, 12540, 12523,
+  24, 12507, 12540, 12531, 32, 12510, 12452, 12463, 12525, 24, 12510, 12452, 12523, 24, 12510, 12483,
+  12495, 24, 12510, 12523, 12463, 40, 12510, 12531, 12471, 12519, 12531, 32, 12511, 12463, 12525, 12531,
+  16, 12511, 12522, 48, 12511, 12522, 12495, 12441, 12540, 12523, 24, 12513, 12459, 12441, 40, 12513,
+  12459, 12441, 12488, 12531, 32, 12513, 12540, 12488, 12523, 32, 12516, 12540, 12488, 12441, 24, 12516,
+  12540, 12523, 24, 12518, 12450, 12531, 32, 12522, 12483, 12488, 12523, 16, 12522, 12521, 32, 12523,
+  12498, 12442, 12540, 40, 12523, 12540, 12501, 12441, 12523, 16, 12524, 12512, 48, 12524, 12531, 12488,
+  12465, 12441, 12531, 24, 12527, 12483, 12488, 16, 48, 28857, 16, 49, 28857, 16, 50, 28857,
+  16, 51, 28857, 16, 52, 28857, 16, 53, 28857, 16, 54, 28857, 16, 55, 28857, 16,
+  56, 28857, 16, 57, 28857, 24, 49, 48, 28857, 24, 49, 49, 28857, 24, 49, 50,
+  28857, 24, 49, 51, 28857, 24, 49, 52, 28857, 24, 49, 53, 28857, 24, 49, 54,
+  28857, 24, 49, 55, 28857, 24, 49, 56, 28857, 24, 49, 57, 28857, 24, 50, 48,
+  28857, 24, 50, 49, 28857, 24, 50, 50, 28857, 24, 50, 51, 28857, 24, 50, 52,
+  28857, 24, 104, 80, 97, 16, 100, 97, 16, 65, 85, 24, 98, 97, 114, 16,
+  111, 86, 16, 112, 99, 16, 100, 109, 24, 100, 109, 50, 24, 100, 109, 51,
+  16, 73, 85, 16, 24179, 25104, 16, 26157, 21644, 16, 22823, 27491, 16, 26126, 27835, 32,
+  26666, 24335, 20250, 31038, 16, 112, 65, 16, 110, 65, 16, 956, 65, 16, 109, 65,
+  16, 107, 65, 16, 75, 66, 16, 77, 66, 16, 71, 66, 24, 99, 97, 108,
+  32, 107, 99, 97, 108, 16, 112, 70, 16, 110, 70, 16, 956, 70, 16, 956,
+  103, 16, 109, 103, 16, 107, 103, 16, 72, 122, 24, 107, 72, 122, 24, 77,
+  72, 122, 24, 71, 72, 122, 24, 84, 72, 122, 16, 956, 108, 16, 109, 108,
+  16, 100, 108, 16, 107, 108, 16, 102, 109, 16, 110, 109, 16, 956, 109, 16,
+  109, 109, 16, 99, 109, 16, 107, 109, 24, 109, 109, 50, 24, 99, 109, 50,
+  16, 109, 50, 24, 107, 109, 50, 24, 109, 109, 51, 24, 99, 109, 51, 16,
+  109, 51, 24, 107, 109, 51, 24, 109, 8725, 115, 32, 109, 8725, 115, 50, 16,
+  80, 97, 24, 107, 80, 97, 24, 77, 80, 97, 24, 71, 80, 97, 24, 114,
+  97, 100, 40, 114, 97, 100, 8725, 115, 48, 114, 97, 100, 8725, 115, 50, 16,
+  112, 115, 16, 110, 115, 16, 956, 115, 16, 109, 115, 16, 112, 86, 16, 110,
+  86, 16, 956, 86, 16, 109, 86, 16, 107, 86, 16, 77, 86, 16, 112, 87,
+  16, 110, 87, 16, 956, 87, 16, 109, 87, 16, 107, 87, 16, 77, 87, 16,
+  107, 937, 16, 77, 937, 32, 97, 46, 109, 46, 16, 66, 113, 16, 99, 99,
+  16, 99, 100, 32, 67, 8725, 107, 103, 24, 67, 111, 46, 16, 100, 66, 16,
+  71, 121, 16, 104, 97, 16, 72, 80, 16, 105, 110, 16, 75, 75, 16, 75,
+  77, 16, 107, 116, 16, 108, 109, 16, 108, 110, 24, 108, 111, 103, 16, 108,
+  120, 16, 109, 98, 24, 109, 105, 108, 24, 109, 111, 108, 16, 80, 72, 32,
+  112, 46, 109, 46, 24, 80, 80, 77, 16, 80, 82, 16, 115, 114, 16, 83,
+  118, 16, 87, 98, 24, 86, 8725, 109, 24, 65, 8725, 109, 16, 49, 26085, 16,
+  50, 26085, 16, 51, 26085, 16, 52, 26085, 16, 53, 26085, 16, 54, 26085, 16, 55,
+  26085, 16, 56, 26085, 16, 57, 26085, 24, 49, 48, 26085, 24, 49, 49, 26085, 24,
+  49, 50, 26085, 24, 49, 51, 26085, 24, 49, 52, 26085, 24, 49, 53, 26085, 24,
+  49, 54, 26085, 24, 49, 55, 26085, 24, 49, 56, 26085, 24, 49, 57, 26085, 24,
+  50, 48, 26085, 24, 50, 49, 26085, 24, 50, 50, 26085, 24, 50, 51, 26085, 24,
+  50, 52, 26085, 24, 50, 53, 26085, 24, 50, 54, 26085, 24, 50, 55, 26085, 24,
+  50, 56, 26085, 24, 50, 57, 26085, 24, 51, 48, 26085, 24, 51, 49, 26085, 24,
+  103, 97, 108, 8, 1098, 8, 1100, 8, 42863, 8, 294, 8, 339, 8, 42791, 8,
+  43831, 8, 619, 8, 43858, 8, 653, 16, 102, 102, 16, 102, 105, 16, 102, 108,
+  24, 102, 102, 105, 24, 102, 102, 108, 16, 115, 116, 16, 115, 116, 16, 1396,
+  1398, 16, 1396, 1381, 16, 1396, 1387, 16, 1406, 1398, 16, 1396, 1389, 8, 1506, 8,
+  1488, 8, 1491, 8, 1492, 8, 1499, 8, 1500, 8, 1501, 8, 1512, 8, 1514, 8,
+  43, 16, 1488, 1500, 8, 1649, 8, 1649, 8, 1659, 8, 1659, 8, 1659, 8, 1659,
+  8, 1662, 8, 1662, 8, 1662, 8, 1662, 8, 1664, 8, 1664, 8, 1664, 8, 1664,
+  8, 1658, 8, 1658, 8, 1658, 8, 1658, 8, 1663, 8, 1663, 8, 1663, 8, 1663,
+  8, 1657, 8, 1657, 8, 1657, 8, 1657, 8, 1700, 8, 1700, 8, 1700, 8, 1700,
+  8, 1702, 8, 1702, 8, 1702, 8, 1702, 8, 1668, 8, 1668, 8, 1668, 8, 1668,
+  8, 1667, 8, 1667, 8, 1667, 8, 1667, 8, 1670, 8, 1670, 8, 1670, 8, 1670,
+  8, 1671, 8, 1671, 8, 1671, 8, 1671, 8, 1677, 8, 1677, 8, 1676, 8, 1676,
+  8, 1678, 8, 1678, 8, 1672, 8, 1672, 8, 1688, 8, 1688, 8, 1681, 8, 1681,
+  8, 1705, 8, 1705, 8, 1705, 8, 1705, 8, 1711, 8, 1711, 8, 1711, 8, 1711,
+  8, 1715, 8, 1715, 8, 1715, 8, 1715, 8, 1713, 8, 1713, 8, 1713, 8, 1713,
+  8, 1722, 8, 1722, 8, 1723, 8, 1723, 8, 1723, 8, 1723, 16, 1749, 1620, 16,
+  1749, 1620, 8, 1729, 8, 1729, 8, 1729, 8, 1729, 8, 1726, 8, 1726, 8, 1726,
+  8, 1726, 8, 1746, 8, 1746, 16, 1746, 1620, 16, 1746, 1620, 8, 1709, 8, 1709,
+  8, 1709, 8, 1709, 8, 1735, 8, 1735, 8, 1734, 8, 1734, 8, 1736, 8, 1736,
+  16, 1735, 1652, 8, 1739, 8, 1739, 8, 1733, 8, 1733, 8, 1737, 8, 1737, 8,
+  1744, 8, 1744, 8, 1744, 8, 1744, 8, 1609, 8, 1609, 24, 1610, 1620, 1575, 24,
+  1610, 1620, 1575, 24, 1610, 1620, 1749, 24, 1610, 1620, 1749, 24, 1610, 1620, 1608, 24,
+  1610, 1620, 1608, 24, 1610, 1620, 1735, 24, 1610, 1620, 1735, 24, 1610, 1620, 1734, 24,
+  1610, 1620, 1734, 24, 1610, 1620, 1736, 24, 1610, 1620, 1736, 24, 1610, 1620, 1744, 24,
+  1610, 1620, 1744, 24, 1610, 1620, 1744, 24, 1610, 1620, 1609, 24, 1610, 1620, 1609, 24,
+  1610, 1620, 1609, 8, 1740, 8, 1740, 8, 1740, 8, 1740, 24, 1610, 1620, 1580, 24,
+  1610, 1620, 1581, 24, 1610, 1620, 1605, 24, 1610, 1620, 1609, 24, 1610, 1620, 1610, 16,
+  1576, 1580, 16, 1576, 1581, 16, 1576, 1582, 16, 1576, 1605, 16, 1576, 1609, 16, 1576,
+  1610, 16, 1578, 1580, 16, 1578, 1581, 16, 1578, 1582, 16, 1578, 1605, 16, 1578, 1609,
+  16, 1578, 1610, 16, 1579, 1580, 16, 1579, 1605, 16, 1579, 1609, 16, 1579, 1610, 16,
+  1580, 1581, 16, 1580, 1605, 16, 1581, 1580, 16, 1581, 1605, 16, 1582, 1580, 16, 1582,
+  1581, 16, 1582, 1605, 16, 1587, 1580, 16, 1587, 1581, 16, 1587, 1582, 16, 1587, 1605,
+  16, 1589, 1581, 16, 1589, 1605, 16, 1590, 1580, 16, 1590, 1581, 16, 1590, 1582, 16,
+  1590, 1605, 16, 1591, 1581, 16, 1591, 1605, 16, 1592, 1605, 16, 1593, 1580, 16, 1593,
+  1605, 16, 1594, 1580, 16, 1594, 1605, 16, 1601, 1580, 16, 1601, 1581, 16, 1601, 1582,
+  16, 1601, 1605, 16, 1601, 1609, 16, 1601, 1610, 16, 1602, 1581, 16, 1602, 1605, 16,
+  1602, 1609, 16, 1602, 1610, 16, 1603, 1575, 16, 1603, 1580, 16, 1603, 1581, 16, 1603,
+  1582, 16, 1603, 1604, 16, 1603, 1605, 16, 1603, 1609, 16, 1603, 1610, 16, 1604, 1580,
+  16, 1604, 1581, 16, 1604, 1582, 16, 1604, 1605, 16, 1604, 1609, 16, 1604, 1610, 16,
+  1605, 1580, 16, 1605, 1581, 16, 1605, 1582, 16, 1605, 1605, 16, 1605, 1609, 16, 1605,
+  1610, 16, 1606, 1580, 16, 1606, 1581, 16, 1606, 1582, 16, 1606, 1605, 16, 1606, 1609,
+  16, 1606, 1610, 16, 1607, 1580, 16, 1607, 1605, 16, 1607, 1609, 16, 1607, 1610, 16,
+  1610, 1580, 16, 1610, 1581, 16, 1610, 1582, 16, 1610, 1605, 16, 1610, 1609, 16, 1610,
+  1610, 16, 1584, 1648, 16, 1585, 1648, 16, 1609, 1648, 24, 32, 1612, 1617, 24, 32,
+  1613, 1617, 24, 32, 1614, 1617, 24, 32, 1615, 1617, 24, 32, 1616, 1617, 24, 32,
+  1617, 1648, 24, 1610, 1620, 1585, 24, 1610, 1620, 1586, 24, 1610, 1620, 1605, 24, 1610,
+  1620, 1606, 24, 1610, 1620, 1609, 24, 1610, 1620, 1610, 16, 1576, 1585, 16, 1576, 1586,
+  16, 1576, 1605, 16, 1576, 1606, 16, 1576, 1609, 16, 1576, 1610, 16, 1578, 1585, 16,
+  1578, 1586, 16, 1578, 1605, 16, 1578, 1606, 16, 1578, 1609, 16, 1578, 1610, 16, 1579,
+  1585, 16, 1579, 1586, 16, 1579, 1605, 16, 1579, 1606, 16, 1579, 1609, 16, 1579, 1610,
+  16, 1601, 1609, 16, 1601, 1610, 16, 1602, 1609, 16, 1602, 1610, 16, 1603, 1575, 16,
+  1603, 1604, 16, 1603, 1605, 16, 1603, 1609, 16, 1603, 1610, 16, 1604, 1605, 16, 1604,
+  1609, 16, 1604, 1610, 16, 1605, 1575, 16, 1605, 1605, 16, 1606, 1585, 16, 1606, 1586,
+  16, 1606, 1605, 16, 1606, 1606, 16, 1606, 1609, 16, 1606, 1610, 16, 1609, 1648, 16,
+  1610, 1585, 16, 1610, 1586, 16, 1610, 1605, 16, 1610, 1606, 16, 1610, 1609, 16, 1610,
+  1610, 24, 1610, 1620, 1580, 24, 1610, 1620, 1581, 24, 1610, 1620, 1582, 24, 1610, 1620,
+  1605, 24, 1610, 1620, 1607, 16, 1576, 1580, 16, 1576, 1581, 16, 1576, 1582, 16, 1576,
+  1605, 16, 1576, 1607, 16, 1578, 1580, 16, 1578, 1581, 16, 1578, 1582, 16, 1578, 1605,
+  16, 1578, 1607, 16, 1579, 1605, 16, 1580, 1581, 16, 1580, 1605, 16, 1581, 1580, 16,
+  1581, 1605, 16, 1582, 1580, 16, 1582, 1605, 16, 1587, 1580, 16, 1587, 1581, 16, 1587,
+  1582, 16, 1587, 1605, 16, 1589, 1581, 16, 1589, 1582, 16, 1589, 1605, 16, 1590, 1580,
+  16, 1590, 1581, 16, 1590, 1582, 16, 1590, 1605, 16, 1591, 1581, 16, 1592, 1605, 16,
+  1593, 1580, 16, 1593, 1605, 16, 1594, 1580, 16, 1594, 1605, 16, 1601, 1580, 16, 1601,
+  1581, 16, 1601, 1582, 16, 1601, 1605, 16, 1602, 1581, 16, 1602, 1605, 16, 1603, 1580,
+  16, 1603, 1581, 16, 1603, 1582, 16, 1603, 1604, 16, 1603, 1605, 16, 1604, 1580, 16,
+  1604, 1581, 16, 1604, 1582, 16, 1604, 1605, 16, 1604, 1607, 16, 1605, 1580, 16, 1605,
+  1581, 16, 1605, 1582, 16, 1605, 1605, 16, 1606, 1580, 16, 1606, 1581, 16, 1606, 1582,
+  16, 1606, 1605, 16, 1606, 1607, 16, 1607, 1580, 16, 1607, 1605, 16, 1607, 1648, 16,
+  1610, 1580, 16, 1610, 1581, 16, 1610, 1582, 16, 1610, 1605, 16, 1610, 1607, 24, 1610,
+  1620, 1605, 24, 1610, 1620, 1607, 16, 1576, 1605, 16, 1576, 1607, 16, 1578, 1605, 16,
+  1578, 1607, 16, 1579, 1605, 16, 1579, 1607, 16, 1587, 1605, 16, 1587, 1607, 16, 1588,
+  1605, 16, 1588, 1607, 16, 1603, 1604, 16, 1603, 1605, 16, 1604, 1605, 16, 1606, 1605,
+  16, 1606, 1607, 16, 1610, 1605, 16, 1610, 1607, 24, 1600, 1614, 1617, 24, 1600, 1615,
+  1617, 24, 1600, 1616, 1617, 16, 1591, 1609, 16, 1591, 1610, 16, 1593, 1609, 16, 1593,
+  1610, 16, 1594, 1609, 16, 1594, 1610, 16, 1587, 1609, 16, 1587, 1610, 16, 1588, 1609,
+  16, 1588, 1610, 16, 1581, 1609, 16, 1581, 1610, 16, 1580, 1609, 16, 1580, 1610, 16,
+  1582, 1609, 16, 1582, 1610, 16, 1589, 1609, 16, 1589, 1610, 16, 1590, 1609, 16, 1590,
+  1610, 16, 1588, 1580, 16, 1588, 1581, 16, 1588, 1582, 16, 1588, 1605, 16, 1588, 1585,
+  16, 1587, 1585, 16, 1589, 1585, 16, 1590, 1585, 16, 1591, 1609, 16, 1591, 1610, 16,
+  1593, 1609, 16, 1593, 1610, 16, 1594, 1609, 16, 1594, 1610, 16, 1587, 1609, 16, 1587,
+  1610, 16, 1588, 1609, 16, 1588, 1610, 16, 1581, 1609, 16, 1581, 1610, 16, 1580, 1609,
+  16, 1580, 1610, 16, 1582, 1609, 16, 1582, 1610, 16, 1589, 1609, 16, 1589, 1610, 16,
+  1590, 1609, 16, 1590, 1610, 16, 1588, 1580, 16, 1588, 1581, 16, 1588, 1582, 16, 1588,
+  1605, 16, 1588, 1585, 16, 1587, 1585, 16, 1589, 1585, 16, 1590, 1585, 16, 1588, 1580,
+  16, 1588, 1581, 16, 1588, 1582, 16, 1588, 1605, 16, 1587, 1607, 16, 1588, 1607, 16,
+  1591, 1605, 16, 1587, 1580, 16, 1587, 1581, 16, 1587, 1582, 16, 1588, 1580, 16, 1588,
+  1581, 16, 1588, 1582, 16, 1591, 1605, 16, 1592, 1605, 16, 1575, 1611, 16, 1575, 1611,
+  24, 1578, 1580, 1605, 24, 1578, 1581, 1580, 24, 1578, 1581, 1580, 24, 1578, 1581, 1605,
+  24, 1578, 1582, 1605, 24, 1578, 1605, 1580, 24, 1578, 1605, 1581, 24, 1578, 1605, 1582,
+  24, 1580, 1605, 1581, 24, 1580, 1605, 1581, 24, 1581, 1605, 1610, 24, 1581, 1605, 1609,
+  24, 1587, 1581, 1580, 24, 1587, 1580, 1581, 24, 1587, 1580, 1609, 24, 1587, 1605, 1581,
+  24, 1587, 1605, 1581, 24, 1587, 1605, 1580, 24, 1587, 1605, 1605, 24, 1587, 1605, 1605,
+  24, 1589, 1581, 1581, 24, 1589, 1581, 1581, 24, 1589, 1605, 1605, 24, 1588, 1581, 1605,
+  24, 1588, 1581, 1605, 24, 1588, 1580, 1610, 24, 1588, 1605, 1582, 24, 1588, 1605, 1582,
+  24, 1588, 1605, 1605, 24, 1588, 1605, 1605, 24, 1590, 1581, 1609, 24, 1590, 1582, 1605,
+  24, 1590, 1582, 1605, 24, 1591, 1605, 1581, 24, 1591, 1605, 1581, 24, 1591, 1605, 1605,
+  24, 1591, 1605, 1610, 24, 1593, 1580, 1605, 24, 1593, 1605, 1605, 24, 1593, 1605, 1605,
+  24, 1593, 1605, 1609, 24, 1594, 1605, 1605, 24, 1594, 1605, 1610, 24, 1594, 1605, 1609,
+  24, 1601, 1582, 1605, 24, 1601, 1582, 1605, 24, 1602, 1605, 1581, 24, 1602, 1605, 1605,
+  24, 1604, 1581, 1605, 24, 1604, 1581, 1610, 24, 1604, 1581, 1609, 24, 1604, 1580, 1580,
+  24, 1604, 1580, 1580, 24, 1604, 1582, 1605, 24, 1604, 1582, 1605, 24, 1604, 1605, 1581,
+  24, 1604, 1605, 1581, 24, 1605, 1581, 1580, 24, 1605, 1581, 1605, 24, 1605, 1581, 1610,
+  24, 1605, 1580, 1581, 24, 1605, 1580, 1605, 24, 1605, 1582, 1580, 24, 1605, 1582, 1605,
+  24, 1605, 1580, 1582, 24, 1607, 1605, 1580, 24, 1607, 1605, 1605, 24, 1606, 1581, 1605,
+  24, 1606, 1581, 1609, 24, 1606, 1580, 1605, 24, 1606, 1580, 1605, 24, 1606, 1580, 1609,
+  24, 1606, 1605, 1610, 24, 1606, 1605, 1609, 24, 1610, 1605, 1605, 24, 1610, 1605, 1605,
+  24, 1576, 1582, 1610, 24, 1578, 1580, 1610, 24, 1578, 1580, 1609, 24, 1578, 1582, 1610,
+  24, 1578, 1582, 1609, 24, 1578, 1605, 1610, 24, 1578, 1605, 1609, 24, 1580, 1605, 1610,
+  24, 1580, 1581, 1609, 24, 1580, 1605, 1609, 24, 1587, 1582, 1609, 24, 1589, 1581, 1610,
+  24, 1588, 1581, 1610, 24, 1590, 1581, 1610, 24, 1604, 1580, 1610, 24, 1604, 1605, 1610,
+  24, 1610, 1581, 1610, 24, 1610, 1580, 1610, 24, 1610, 1605, 1610, 24, 1605, 1605, 1610,
+  24, 1602, 1605, 1610, 24, 1606, 1581, 1610, 24, 1602, 1605, 1581, 24, 1604, 1581, 1605,
+  24, 1593, 1605, 1610, 24, 1603, 1605, 1610, 24, 1606, 1580, 1581, 24, 1605, 1582, 1610,
+  24, 1604, 1580, 1605, 24, 1603, 1605, 1605, 24, 1604, 1580, 1605, 24, 1606, 1580, 1581,
+  24, 1580, 1581, 1610, 24, 1581, 1580, 1610, 24, 1605, 1580, 1610, 24, 1601, 1605, 1610,
+  24, 1576, 1581, 1610, 24, 1603, 1605, 1605, 24, 1593, 1580, 1605, 24, 1589, 1605, 1605,
+  24, 1587, 1582, 1610, 24, 1606, 1580, 1610, 24, 1589, 1604, 1746, 24, 1602, 1604, 1746,
+  32, 1575, 1604, 1604, 1607, 32, 1575, 1603, 1576, 1585, 32, 1605, 1581, 1605, 1583, 32,
+  1589, 1604, 1593, 1605, 32, 1585, 1587, 1608, 1604, 32, 1593, 1604, 1610, 1607, 32, 1608,
+  1587, 1604, 1605, 24, 1589, 1604, 1609, 144, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607,
+  32, 1593, 1604, 1610, 1607, 32, 1608, 1587, 1604, 1605, 64, 1580, 1604, 32, 1580, 1604,
+  1575, 1604, 1607, 32, 1585, 1740, 1575, 1604, 8, 44, 8, 12289, 8, 12290, 8, 58,
+  8, 59, 8, 33, 8, 63, 8, 12310, 8, 12311, 24, 46, 46, 46, 16, 46,
+  46, 8, 8212, 8, 8211, 8, 95, 8, 95, 8, 40, 8, 41, 8, 123, 8,
+  125, 8, 12308, 8, 12309, 8, 12304, 8, 12305, 8, 12298, 8, 12299, 8, 12296, 8,
+  12297, 8, 12300, 8, 12301, 8, 12302, 8, 12303, 8, 91, 8, 93, 16, 32, 773,
+  16, 32, 773, 16, 32, 773, 16, 32, 773, 8, 95, 8, 95, 8, 95, 8,
+  44, 8, 12289, 8, 46, 8, 59, 8, 58, 8, 63, 8, 33, 8, 8212, 8,
+  40, 8, 41, 8, 123, 8, 125, 8, 12308, 8, 12309, 8, 35, 8, 38, 8,
+  42, 8, 43, 8, 45, 8, 60, 8, 62, 8, 61, 8, 92, 8, 36, 8,
+  37, 8, 64, 16, 32, 1611, 16, 1600, 1611, 16, 32, 1612, 16, 32, 1613, 16,
+  32, 1614, 16, 1600, 1614, 16, 32, 1615, 16, 1600, 1615, 16, 32, 1616, 16, 1600,
+  1616, 16, 32, 1617, 16, 1600, 1617, 16, 32, 1618, 16, 1600, 1618, 8, 1569, 16,
+  1575, 1619, 16, 1575, 1619, 16, 1575, 1620, 16, 1575, 1620, 16, 1608, 1620, 16, 1608,
+  1620, 16, 1575, 1621, 16, 1575, 1621, 16, 1610, 1620, 16, 1610, 1620, 16, 1610, 1620,
+  16, 1610, 1620, 8, 1575, 8, 1575, 8, 1576, 8, 1576, 8, 1576, 8, 1576, 8,
+  1577, 8, 1577, 8, 1578, 8, 1578, 8, 1578, 8, 1578, 8, 1579, 8, 1579, 8,
+  1579, 8, 1579, 8, 1580, 8, 1580, 8, 1580, 8, 1580, 8, 1581, 8, 1581, 8,
+  1581, 8, 1581, 8, 1582, 8, 1582, 8, 1582, 8, 1582, 8, 1583, 8, 1583, 8,
+  1584, 8, 1584, 8, 1585, 8, 1585, 8, 1586, 8, 1586, 8, 1587, 8, 1587, 8,
+  1587, 8, 1587, 8, 1588, 8, 1588, 8, 1588, 8, 1588, 8, 1589, 8, 1589, 8,
+  1589, 8, 1589, 8, 1590, 8, 1590, 8, 1590, 8, 1590, 8, 1591, 8, 1591, 8,
+  1591, 8, 1591, 8, 1592, 8, 1592, 8, 1592, 8, 1592, 8, 1593, 8, 1593, 8,
+  1593, 8, 1593, 8, 1594, 8, 1594, 8, 1594, 8, 1594, 8, 1601, 8, 1601, 8,
+  1601, 8, 1601, 8, 1602, 8, 1602, 8, 1602, 8, 1602, 8, 1603, 8, 1603, 8,
+  1603, 8, 1603, 8, 1604, 8, 1604, 8, 1604, 8, 1604, 8, 1605, 8, 1605, 8,
+  1605, 8, 1605, 8, 1606, 8, 1606, 8, 1606, 8, 1606, 8, 1607, 8, 1607, 8,
+  1607, 8, 1607, 8, 1608, 8, 1608, 8, 1609, 8, 1609, 8, 1610, 8, 1610, 8,
+  1610, 8, 1610, 24, 1604, 1575, 1619, 24, 1604, 1575, 1619, 24, 1604, 1575, 1620, 24,
+  1604, 1575, 1620, 24, 1604, 1575, 1621, 24, 1604, 1575, 1621, 16, 1604, 1575, 16, 1604,
+  1575, 8, 33, 8, 34, 8, 35, 8, 36, 8, 37, 8, 38, 8, 39, 8,
+  40, 8, 41, 8, 42, 8, 43, 8, 44, 8, 45, 8, 46, 8, 47, 8,
+  48, 8, 49, 8, 50, 8, 51, 8, 52, 8, 53, 8, 54, 8, 55, 8,
+  56, 8, 57, 8, 58, 8, 59, 8, 60, 8, 61, 8, 62, 8, 63, 8,
+  64, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8,
+  72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8,
+  80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8,
+  88, 8, 89, 8, 90, 8, 91, 8, 92, 8, 93, 8, 94, 8, 95, 8,
+  96, 8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8,
+  104, 8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8,
+  112, 8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8,
+  120, 8, 121, 8, 122, 8, 123, 8, 124, 8, 125, 8, 126, 8, 10629, 8,
+  10630, 8, 12290, 8, 12300, 8, 12301, 8, 12289, 8, 12539, 8, 12530, 8, 12449, 8,
+  12451, 8, 12453, 8, 12455, 8, 12457, 8, 12515, 8, 12517, 8, 12519, 8, 12483, 8,
+  12540, 8, 12450, 8, 12452, 8, 12454, 8, 12456, 8, 12458, 8, 12459, 8, 12461, 8,
+  12463, 8, 12465, 8, 12467, 8, 12469, 8, 12471, 8, 12473, 8, 12475, 8, 12477, 8,
+  12479, 8, 12481, 8, 12484, 8, 12486, 8, 12488, 8, 12490, 8, 12491, 8, 12492, 8,
+  12493, 8, 12494, 8, 12495, 8, 12498, 8, 12501, 8, 12504, 8, 12507, 8, 12510, 8,
+  12511, 8, 12512, 8, 12513, 8, 12514, 8, 12516, 8, 12518, 8, 12520, 8, 12521, 8,
+  12522, 8, 12523, 8, 12524, 8, 12525, 8, 12527, 8, 12531, 8, 12441, 8, 12442, 8,
+  4448, 8, 4352, 8, 4353, 8, 4522, 8, 4354, 8, 4524, 8, 4525, 8, 4355, 8,
+  4356, 8, 4357, 8, 4528, 8, 4529, 8, 4530, 8, 4531, 8, 4532, 8, 4533, 8,
+  4378, 8, 4358, 8, 4359, 8, 4360, 8, 4385, 8, 4361, 8, 4362, 8, 4363, 8,
+  4364, 8, 4365, 8, 4366, 8, 4367, 8, 4368, 8, 4369, 8, 4370, 8, 4449, 8,
+  4450, 8, 4451, 8, 4452, 8, 4453, 8, 4454, 8, 4455, 8, 4456, 8, 4457, 8,
+  4458, 8, 4459, 8, 4460, 8, 4461, 8, 4462, 8, 4463, 8, 4464, 8, 4465, 8,
+  4466, 8, 4467, 8, 4468, 8, 4469, 8, 162, 8, 163, 8, 172, 16, 32, 772,
+  8, 166, 8, 165, 8, 8361, 8, 9474, 8, 8592, 8, 8593, 8, 8594, 8, 8595,
+  8, 9632, 8, 9675, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70,
+  8, 71, 8, 72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78,
+  8, 79, 8, 80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86,
+  8, 87, 8, 88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100,
+  8, 101, 8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108,
+  8, 109, 8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 66,
+  8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8, 74,
+  8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8, 82,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90,
+  8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 105,
+  8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112, 8, 113,
+  8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120, 8, 121,
+  8, 122, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70, 8, 71,
+  8, 72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79,
+  8, 80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86, 8, 87,
+  8, 88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100, 8, 101,
+  8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108, 8, 109,
+  8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116, 8, 117,
+  8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 67, 8, 68,
+  8, 71, 8, 74, 8, 75, 8, 78, 8, 79, 8, 80, 8, 81, 8, 83,
+  8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90, 8, 97,
+  8, 98, 8, 99, 8, 100, 8, 102, 8, 104, 8, 105, 8, 106, 8, 107,
+  8, 108, 8, 109, 8, 110, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 66,
+  8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8, 74,
+  8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8, 82,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90,
+  8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 104,
+  8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112,
+  8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120,
+  8, 121, 8, 122, 8, 65, 8, 66, 8, 68, 8, 69, 8, 70, 8, 71,
+  8, 74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 97,
+  8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 104, 8, 105,
+  8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112, 8, 113,
+  8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120, 8, 121,
+  8, 122, 8, 65, 8, 66, 8, 68, 8, 69, 8, 70, 8, 71, 8, 73,
+  8, 74, 8, 75, 8, 76, 8, 77, 8, 79, 8, 83, 8, 84, 8, 85,
+  8, 86, 8, 87, 8, 88, 8, 89, 8, 97, 8, 98, 8, 99, 8, 100,
+  8, 101, 8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108,
+  8, 109, 8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 66,
+  8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8, 74,
+  8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8, 82,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90,
+  8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 104,
+  8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112,
+  8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120,
+  8, 121, 8, 122, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70,
+  8, 71, 8, 72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78,
+  8, 79, 8, 80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86,
+  8, 87, 8, 88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100,
+  8, 101, 8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108,
+  8, 109, 8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 66,
+  8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8, 74,
+  8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8, 82,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90,
+  8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 104,
+  8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112,
+  8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120,
+  8, 121, 8, 122, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70,
+  8, 71, 8, 72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78,
+  8, 79, 8, 80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86,
+  8, 87, 8, 88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100,
+  8, 101, 8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108,
+  8, 109, 8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 65, 8, 66,
+  8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8, 74,
+  8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8, 82,
+  8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8, 90,
+  8, 97, 8, 98, 8, 99, 8, 100, 8, 101, 8, 102, 8, 103, 8, 104,
+  8, 105, 8, 106, 8, 107, 8, 108, 8, 109, 8, 110, 8, 111, 8, 112,
+  8, 113, 8, 114, 8, 115, 8, 116, 8, 117, 8, 118, 8, 119, 8, 120,
+  8, 121, 8, 122, 8, 65, 8, 66, 8, 67, 8, 68, 8, 69, 8, 70,
+  8, 71, 8, 72, 8, 73, 8, 74, 8, 75, 8, 76, 8, 77, 8, 78,
+  8, 79, 8, 80, 8, 81, 8, 82, 8, 83, 8, 84, 8, 85, 8, 86,
+  8, 87, 8, 88, 8, 89, 8, 90, 8, 97, 8, 98, 8, 99, 8, 100,
+  8, 101, 8, 102, 8, 103, 8, 104, 8, 105, 8, 106, 8, 107, 8, 108,
+  8, 109, 8, 110, 8, 111, 8, 112, 8, 113, 8, 114, 8, 115, 8, 116,
+  8, 117, 8, 118, 8, 119, 8, 120, 8, 121, 8, 122, 8, 305, 8, 567,
+  8, 913, 8, 914, 8, 915, 8, 916, 8, 917, 8, 918, 8, 919, 8, 920,
+  8, 921, 8, 922, 8, 923, 8, 924, 8, 925, 8, 926, 8, 927, 8, 928,
+  8, 929, 8, 920, 8, 931, 8, 932, 8, 933, 8, 934, 8, 935, 8, 936,
+  8, 937, 8, 8711, 8, 945, 8, 946, 8, 947, 8, 948, 8, 949, 8, 950,
+  8, 951, 8, 952, 8, 953, 8, 954, 8, 955, 8, 956, 8, 957, 8, 958,
+  8, 959, 8, 960, 8, 961, 8, 962, 8, 963, 8, 964, 8, 965, 8, 966,
+  8, 967, 8, 968, 8, 969, 8, 8706, 8, 949, 8, 952, 8, 954, 8, 966,
+  8, 961, 8, 960, 8, 913, 8, 914, 8, 915, 8, 916, 8, 917, 8, 918,
+  8, 919, 8, 920, 8, 921, 8, 922, 8, 923, 8, 924, 8, 925, 8, 926,
+  8, 927, 8, 928, 8, 929, 8, 920, 8, 931, 8, 932, 8, 933, 8, 934,
+  8, 935, 8, 936, 8, 937, 8, 8711, 8, 945, 8, 946, 8, 947, 8, 948,
+  8, 949, 8, 950, 8, 951, 8, 952, 8, 953, 8, 954, 8, 955, 8, 956,
+  8, 957, 8, 958, 8, 959, 8, 960, 8, 961, 8, 962, 8, 963, 8, 964,
+  8, 965, 8, 966, 8, 967, 8, 968, 8, 969, 8, 8706, 8, 949, 8, 952,
+  8, 954, 8, 966, 8, 961, 8, 960, 8, 913, 8, 914, 8, 915, 8, 916,
+  8, 917, 8, 918, 8, 919, 8, 920, 8, 921, 8, 922, 8, 923, 8, 924,
+  8, 925, 8, 926, 8, 927, 8, 928, 8, 929, 8, 920, 8, 931, 8, 932,
+  8, 933, 8, 934, 8, 935, 8, 936, 8, 937, 8, 8711, 8, 945, 8, 946,
+  8, 947, 8, 948, 8, 949, 8, 950, 8, 951, 8, 952, 8, 953, 8, 954,
+  8, 955, 8, 956, 8, 957, 8, 958, 8, 959, 8, 960, 8, 961, 8, 962,
+  8, 963, 8, 964, 8, 965, 8, 966, 8, 967, 8, 968, 8, 969, 8, 8706,
+  8, 949, 8, 952, 8, 954, 8, 966, 8, 961, 8, 960, 8, 913, 8, 914,
+  8, 915, 8, 916, 8, 917, 8, 918, 8, 919, 8, 920, 8, 921, 8, 922,
+  8, 923, 8, 924, 8, 925, 8, 926, 8, 927, 8, 928, 8, 929, 8, 920,
+  8, 931, 8, 932, 8, 933, 8, 934, 8, 935, 8, 936, 8, 937, 8, 8711,
+  8, 945, 8, 946, 8, 947, 8, 948, 8, 949, 8, 950, 8, 951, 8, 952,
+  8, 953, 8, 954, 8, 955, 8, 956, 8, 957, 8, 958, 8, 959, 8, 960,
+  8, 961, 8, 962, 8, 963, 8, 964, 8, 965, 8, 966, 8, 967, 8, 968,
+  8, 969, 8, 8706, 8, 949, 8, 952, 8, 954, 8, 966, 8, 961, 8, 960,
+  8, 913, 8, 914, 8, 915, 8, 916, 8, 917, 8, 918, 8, 919, 8, 920,
+  8, 921, 8, 922, 8, 923, 8, 924, 8, 925, 8, 926, 8, 927, 8, 928,
+  8, 929, 8, 920, 8, 931, 8, 932, 8, 933, 8, 934, 8, 935, 8, 936,
+  8, 937, 8, 8711, 8, 945, 8, 946, 8, 947, 8, 948, 8, 949, 8, 950,
+  8, 951, 8, 952, 8, 953, 8, 954, 8, 955, 8, 956, 8, 957, 8, 958,
+  8, 959, 8, 960, 8, 961, 8, 962, 8, 963, 8, 964, 8, 965, 8, 966,
+  8, 967, 8, 968, 8, 969, 8, 8706, 8, 949, 8, 952, 8, 954, 8, 966,
+  8, 961, 8, 960, 8, 988, 8, 989, 8, 48, 8, 49, 8, 50, 8, 51,
+  8, 52, 8, 53, 8, 54, 8, 55, 8, 56, 8, 57, 8, 48, 8, 49,
+  8, 50, 8, 51, 8, 52, 8, 53, 8, 54, 8, 55, 8, 56, 8, 57,
+  8, 48, 8, 49, 8, 50, 8, 51, 8, 52, 8, 53, 8, 54, 8, 55,
+  8, 56, 8, 57, 8, 48, 8, 49, 8, 50, 8, 51, 8, 52, 8, 53,
+  8, 54, 8, 55, 8, 56, 8, 57, 8, 48, 8, 49, 8, 50, 8, 51,
+  8, 52, 8, 53, 8, 54, 8, 55, 8, 56, 8, 57, 8, 1575, 8, 1576,
+  8, 1580, 8, 1583, 8, 1608, 8, 1586, 8, 1581, 8, 1591, 8, 1610, 8, 1603,
+  8, 1604, 8, 1605, 8, 1606, 8, 1587, 8, 1593, 8, 1601, 8, 1589, 8, 1602,
+  8, 1585, 8, 1588, 8, 1578, 8, 1579, 8, 1582, 8, 1584, 8, 1590, 8, 1592,
+  8, 1594, 8, 1646, 8, 1722, 8, 1697, 8, 1647, 8, 1576, 8, 1580, 8, 1607,
+  8, 1581, 8, 1610, 8, 1603, 8, 1604, 8, 1605, 8, 1606, 8, 1587, 8, 1593,
+  8, 1601, 8, 1589, 8, 1602, 8, 1588, 8, 1578, 8, 1579, 8, 1582, 8, 1590,
+  8, 1594, 8, 1580, 8, 1581, 8, 1610, 8, 1604, 8, 1606, 8, 1587, 8, 1593,
+  8, 1589, 8, 1602, 8, 1588, 8, 1582, 8, 1590, 8, 1594, 8, 1722, 8, 1647,
+  8, 1576, 8, 1580, 8, 1607, 8, 1581, 8, 1591, 8, 1610, 8, 1603, 8, 1605,
+  8, 1606, 8, 1587, 8, 1593, 8, 1601, 8, 1589, 8, 1602, 8, 1588, 8, 1578,
+  8, 1579, 8, 1582, 8, 1590, 8, 1592, 8, 1594, 8, 1646, 8, 1697, 8, 1575,
+  8, 1576, 8, 1580, 8, 1583, 8, 1607, 8, 1608, 8, 1586, 8, 1581, 8, 1591,
+  8, 1610, 8, 1604, 8, 1605, 8, 1606, 8, 1587, 8, 1593, 8, 1601, 8, 1589,
+  8, 1602, 8, 1585, 8, 1588, 8, 1578, 8, 1579, 8, 1582, 8, 1584, 8, 1590,
+  8, 1592, 8, 1594, 8, 1576, 8, 1580, 8, 1583, 8, 1608, 8, 1586, 8, 1581,
+  8, 1591, 8, 1610, 8, 1604, 8, 1605, 8, 1606, 8, 1587, 8, 1593, 8, 1601,
+  8, 1589, 8, 1602, 8, 1585, 8, 1588, 8, 1578, 8, 1579, 8, 1582, 8, 1584,
+  8, 1590, 8, 1592, 8, 1594, 16, 48, 46, 16, 48, 44, 16, 49, 44, 16,
+  50, 44, 16, 51, 44, 16, 52, 44, 16, 53, 44, 16, 54, 44, 16, 55,
+  44, 16, 56, 44, 16, 57, 44, 24, 40, 65, 41, 24, 40, 66, 41, 24,
+  40, 67, 41, 24, 40, 68, 41, 24, 40, 69, 41, 24, 40, 70, 41, 24,
+  40, 71, 41, 24, 40, 72, 41, 24, 40, 73, 41, 24, 40, 74, 41, 24,
+  40, 75, 41, 24, 40, 76, 41, 24, 40, 77, 41, 24, 40, 78, 41, 24,
+  40, 79, 41, 24, 40, 80, 41, 24, 40, 81, 41, 24, 40, 82, 41, 24,
+  40, 83, 41, 24, 40, 84, 41, 24, 40, 85, 41, 24, 40, 86, 41, 24,
+  40, 87, 41, 24, 40, 88, 41, 24, 40, 89, 41, 24, 40, 90, 41, 24,
+  12308, 83, 12309, 8, 67, 8, 82, 16, 67, 68, 16, 87, 90, 8, 65, 8,
+  66, 8, 67, 8, 68, 8, 69, 8, 70, 8, 71, 8, 72, 8, 73, 8,
+  74, 8, 75, 8, 76, 8, 77, 8, 78, 8, 79, 8, 80, 8, 81, 8,
+  82, 8, 83, 8, 84, 8, 85, 8, 86, 8, 87, 8, 88, 8, 89, 8,
+  90, 16, 72, 86, 16, 77, 86, 16, 83, 68, 16, 83, 83, 24, 80, 80,
+  86, 16, 87, 67, 16, 77, 67, 16, 77, 68, 16, 77, 82, 16, 68, 74,
+  16, 12411, 12363, 16, 12467, 12467, 8, 12469, 8, 25163, 8, 23383, 8, 21452, 16, 12486,
+  12441, 8, 20108, 8, 22810, 8, 35299, 8, 22825, 8, 20132, 8, 26144, 8, 28961, 8,
+  26009, 8, 21069, 8, 24460, 8, 20877, 8, 26032, 8, 21021, 8, 32066, 8, 29983, 8,
+  36009, 8, 22768, 8, 21561, 8, 28436, 8, 25237, 8, 25429, 8, 19968, 8, 19977, 8,
+  36938, 8, 24038, 8, 20013, 8, 21491, 8, 25351, 8, 36208, 8, 25171, 8, 31105, 8,
+  31354, 8, 21512, 8, 28288, 8, 26377, 8, 26376, 8, 30003, 8, 21106, 8, 21942, 8,
+  37197, 24, 12308, 26412, 12309, 24, 12308, 19977, 12309, 24, 12308, 20108, 12309, 24, 12308, 23433,
+  12309, 24, 12308, 28857, 12309, 24, 12308, 25171, 12309, 24, 12308, 30423, 12309, 24, 12308, 21213,
+  12309, 24, 12308, 25943, 12309, 8, 24471, 8, 21487, 8, 48, 8, 49, 8, 50, 8,
+  51, 8, 52, 8, 53, 8, 54, 8, 55, 8, 56, 8, 57,
+};
+
+} // namespace unilib
+} // namespace ufal
@@ -1,12 +1,20 @@
-#include <string>
-#include <functional>
+#pragma once
 
-struct User {
-    std::u32string name;
-    std::string phoneNumber;
+#include <string_view>
+
+#include "internPool.hpp"
+#include "phoneNumber.hpp"
+#include "stringPool.hpp"
 
-    User(const std::u32string& n, const std::string& p) : name(n), phoneNumber(p) {};
-    User(User&&) = default;
+// A user as it is kept in the UserStore, just two handles into the store's pools
+// The name is the NFC normalized name in UTF-8
+struct User {
+    StringPool::Handle name;
+    InternPool<PhoneNumber>::Handle phoneNumber;
+};
 
-    auto operator<=>(const User&) const = default;
-};
\ No newline at end of file
+// What the store hands out when looking at a user. The name points into the store's pool
+struct UserView {
+    std::string_view name;
+    PhoneNumber phoneNumber;
+};
@@ -0,0 +1,245 @@
+#include "userStore.hpp"
+
+UserStore::const_iterator::const_iterator(const UserStore* store, uint32_t slot) : Store(store), Slot(slot) {
+    // step over erased users so the iterator always points at a real one or the end
+    while (Slot < Store->Users.size() && Store->Users[Slot].name == StringPool::None) Slot++;
+    if (Slot < Store->Users.size()) {
+        const User& user = Store->Users[Slot];
+        View = {Store->Names.get(user.name), Store->PhoneNumbers.get(user.phoneNumber)};
+    }
+}
+
+UserStore::const_iterator& UserStore::const_iterator::operator++() {
+    *this = const_iterator(Store, Slot + 1);
+    return *this;
+}
+
+UserStore::NameCursor::NameCursor(const UserStore* store, std::string_view prefix)
+    : Store(store), Prefix(prefix), At(store->SortedNames.lowerBound(prefix, store->Names)) {
+    load();
+}
+
+void UserStore::NameCursor::next() {
+    Store->SortedNames.advance(At);
+    load();
+}
+
+size_t UserStore::NameCursor::skipBefore(std::string_view name) {
+    if (Done || name <= Name) return 0;
+    // Every name between here and name starts with the prefix as well, since both of them do, so the names in
+    // between are never looked at, only how many users they have
+    NameIndex::Position stop = Store->SortedNames.lowerBound(name, Store->Names);
+    size_t skipped = 0;
+    Store->SortedNames.forEachBetween(At, stop, [&](StringPool::Handle handle) { skipped += Store->NameChains[handle].count; });
+    At = stop;
+    load();
+    return skipped;
+}
+
+size_t UserStore::NameCursor::skipUsers(size_t offset) {
+    if (Done) return 0;
+    // only a cursor with a prefix has to look at the names to know where to stop
+    size_t skipped = 0;
+    Store->SortedNames.advanceWhile(At, [&](StringPool::Handle handle) {
+        uint32_t count = Store->NameChains[handle].count;
+        if (skipped + count > offset || (!Prefix.empty() && !Store->Names.get(handle).starts_with(Prefix))) return false;
+        skipped += count;
+        return true;
+    });
+    load();
+    return skipped;
+}
+
+std::optional<std::string_view> UserStore::NameCursor::nameAhead(size_t names) const {
+    if (Done) return std::nullopt;
+    NameIndex::Position ahead = At;
+    Store->SortedNames.advance(ahead, names);
+    if (Store->SortedNames.atEnd(ahead)) return std::nullopt;
+    std::string_view name = Store->Names.get(Store->SortedNames.get(ahead));
+    if (!name.starts_with(Prefix)) return std::nullopt;
+    return name;
+}
+
+void UserStore::NameCursor::load() {
+    if (Store->SortedNames.atEnd(At)) {
+        Done = true;
+        return;
+    }
+    Handle = Store->SortedNames.get(At);
+    Name = Store->Names.get(Handle);
+    Done = !Name.starts_with(Prefix);
+}
+
+// adds a user to the end of the list for its name or phone number
+template<uint32_t UserStore::Links::*Previous, uint32_t UserStore::Links::*Next>
+void UserStore::link(Chain& chain, uint32_t slot) {
+    UserLinks.mutate(slot).*Previous = chain.last;
+    if (chain.last != Nil) UserLinks.mutate(chain.last).*Next = slot;
+    else chain.first = slot;
+    chain.last = slot;
+    chain.count++;
+}
+
+template<uint32_t UserStore::Links::*Previous, uint32_t UserStore::Links::*Next>
+void UserStore::unlink(Chain& chain, uint32_t slot) {
+    uint32_t previous = UserLinks[slot].*Previous;
+    uint32_t next = UserLinks[slot].*Next;
+    if (previous != Nil) UserLinks.mutate(previous).*Next = next;
+    else chain.first = next;
+    if (next != Nil) UserLinks.mutate(next).*Previous = previous;
+    else chain.last = previous;
+    chain.count--;
+}
+
+uint32_t UserStore::findSlot(StringPool::Handle name, InternPool<PhoneNumber>::Handle phoneNumber) const {
+    if (name == StringPool::None || phoneNumber == InternPool<PhoneNumber>::None) return Nil;
+
+    // usually a phone number only has one user, but a common name can have thousands, so walk whichever is shorter
+    if (PhoneChains[phoneNumber].count <= NameChains[name].count) {
+        for (uint32_t slot = PhoneChains[phoneNumber].first; slot != Nil; slot = UserLinks[slot].nextPhone) {
+            if (Users[slot].name == name) return slot;
+        }
+    } else {
+        for (uint32_t slot = NameChains[name].first; slot != Nil; slot = UserLinks[slot].nextName) {
+            if (Users[slot].phoneNumber == phoneNumber) return slot;
+        }
+    }
+    return Nil;
+}
+
+StringPool::Handle UserStore::internName(std::string_view name) {
+    StringPool::Handle handle = Names.intern(name);
+    if (NameChains.size() < Names.size()) NameChains.resize(Names.size());
+    return handle;
+}
+
+bool UserStore::insert(StringPool::Handle nameHandle, const PhoneNumber& phoneNumber, uint64_t order) {
+    // the strings are interned even for a duplicate, but then they were already in the pools anyway
+    InternPool<PhoneNumber>::Handle phoneHandle = PhoneNumbers.intern(phoneNumber);
+    if (PhoneChains.size() < PhoneNumbers.size()) PhoneChains.resize(PhoneNumbers.size());
+
+    if (findSlot(nameHandle, phoneHandle) != Nil) return false;
+
+    uint32_t slot = Users.size();
+    Users.push_back({nameHandle, phoneHandle});
+    UserLinks.push_back({});
+    Orders.push_back(order);
+    NextOrder = order + 1;
+    if (NamesSorted && NameChains[nameHandle].count == 0) SortedNames.insert(nameHandle, Names);
+    link<&Links::previousName, &Links::nextName>(NameChains.mutate(nameHandle), slot);
+    link<&Links::previousPhone, &Links::nextPhone>(PhoneChains[phoneHandle], slot);
+    Live++;
+
+    return true;
+}
+
+void UserStore::erase(const_iterator it) {
+    uint32_t slot = it.Slot;
+    User user = Users[slot];
+    unlink<&Links::previousName, &Links::nextName>(NameChains.mutate(user.name), slot);
+    if (NamesSorted && NameChains[user.name].count == 0) SortedNames.erase(user.name, Names);
+    unlink<&Links::previousPhone, &Links::nextPhone>(PhoneChains[user.phoneNumber], slot);
+    Users.mutate(slot).name = StringPool::None;
+    Live--;
+
+    // rebuilding costs about as much as the erases since the last one, so erasing stays O(1) on average
+    if (Users.size() > 1024 && Live < Users.size() / 2) rebuild();
+}
+
+size_t UserStore::skipBefore(const_iterator& it, uint64_t order) const {
+    // the orders only go up, erased users included, so where to stop is a binary search
+    uint32_t stop = it.Slot;
+    for (uint32_t end = Orders.size(); stop < end;) {
+        uint32_t middle = stop + (end - stop) / 2;
+        if (Orders[middle] < order) stop = middle + 1;
+        else end = middle;
+    }
+    size_t skipped = 0;
+    for (uint32_t slot = it.Slot; slot < stop; slot++) skipped += Users[slot].name != StringPool::None;
+    it = const_iterator(this, stop);
+    return skipped;
+}
+
+UserStore::const_iterator UserStore::find(std::string_view name, const PhoneNumber& phoneNumber) const {
+    uint32_t slot = findSlot(Names.find(name), PhoneNumbers.find(phoneNumber));
+    return slot == Nil ? end() : const_iterator(this, slot);
+}
+
+void UserStore::clear() {
+    *this = UserStore();
+}
+
+UserStore UserStore::snapshot() const {
+    UserStore copy;
+    copy.Names = Names.snapshot();
+    copy.PhoneNumbers = PhoneNumbers.snapshot();
+    copy.Users = Users;
+    copy.UserLinks = UserLinks;
+    copy.Orders = Orders;
+    copy.NextOrder = NextOrder;
+    copy.NameChains = NameChains;
+    copy.SortedNames = SortedNames;
+    copy.NamesSorted = NamesSorted;
+    copy.Live = Live;
+    return copy;
+}
+
+std::vector<UserStore::const_iterator> UserStore::findByName(std::string_view name) const {
+    std::vector<const_iterator> matches;
+    StringPool::Handle handle = Names.find(name);
+    if (handle == StringPool::None) return matches;
+
+    matches.reserve(NameChains[handle].count);
+    for (uint32_t slot = NameChains[handle].first; slot != Nil; slot = UserLinks[slot].nextName) {
+        matches.push_back(const_iterator(this, slot));
+    }
+    return matches;
+}
+
+std::vector<UserStore::const_iterator> UserStore::findByPhoneNumber(const PhoneNumber& phoneNumber) const {
+    std::vector<const_iterator> matches;
+    InternPool<PhoneNumber>::Handle handle = PhoneNumbers.find(phoneNumber);
+    if (handle == InternPool<PhoneNumber>::None) return matches;
+
+    matches.reserve(PhoneChains[handle].count);
+    for (uint32_t slot = PhoneChains[handle].first; slot != Nil; slot = UserLinks[slot].nextPhone) {
+        matches.push_back(const_iterator(this, slot));
+    }
+    return matches;
+}
+
+void UserStore::reserve(size_t count) {
+    // names are usually shared, but phone numbers almost never are
+    Users.reserve(count);
+    UserLinks.reserve(count);
+    Orders.reserve(count);
+    PhoneNumbers.reserve(count);
+    PhoneChains.reserve(count);
+}
+
+void UserStore::rebuild() {
+    // adding the remaining users to a new store keeps their order and leaves out strings only erased users had
+    // The sorted names are built again straight away if they were being kept, so a rebuild never leaves them for a
+    // search to build
+    UserStore rebuilt;
+    rebuilt.reserve(Live);
+    for (auto it = begin(); it != end(); ++it) rebuilt.insert(it->name, it->phoneNumber, it.order());
+    rebuilt.NextOrder = NextOrder;
+    bool sorted = NamesSorted;
+    *this = std::move(rebuilt);
+    if (sorted) buildNameIndex();
+}
+
+void UserStore::buildNameIndex() const {
+    std::vector<StringPool::Handle> names;
+    for (StringPool::Handle name = 0; name < NameChains.size(); name++) {
+        if (NameChains[name].count) names.push_back(name);
+    }
+    SortedNames.build(std::move(names), Names);
+    NamesSorted = true;
+}
+
+size_t UserStore::memoryUsage() const {
+    return Names.memoryUsage() + PhoneNumbers.memoryUsage() + Users.memoryUsage() + UserLinks.memoryUsage() + Orders.memoryUsage()
+        + NameChains.memoryUsage() + PhoneChains.capacity() * sizeof(Chain) + SortedNames.memoryUsage();
+}
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "cow.hpp"
+#include "internPool.hpp"
+#include "nameIndex.hpp"
+#include "phoneNumber.hpp"
+#include "stringPool.hpp"
+#include "user.hpp"
+
+// Holds every user in insertion order
+//
+// Names are interned in a StringPool and phone numbers in an InternPool, so a name shared by a thousand users
+// is stored once and a user itself is only two 32 bit handles. Users live in a vector in the order they were added.
+// Erasing one leaves a hole that iteration skips, and once more than half the vector is holes the
+// whole store is rebuilt, which also drops the names and phone numbers nobody uses anymore.
+//
+// Every user with the same name is linked together in insertion order, and the same for phone numbers.
+// The first and last user of each list are kept per handle, so finding every user with a name is one
+// pool lookup plus the matches, and checking for a duplicate only walks the shorter of the two lists.
+//
+// The names are also kept sorted in a NameIndex, which is what finding users by the start of their name and
+// listing them in order use. Only names that still have a user are in it. Keeping it up to date makes adding
+// a new name about 40% slower, so it is only built the first time it is needed and kept up to date from then on.
+// Loading a file does not pay for it unless something searches afterwards.
+//
+// Every user also has a number that goes up in the order they were added. A store on its own numbers them itself,
+// but the shards of a ShardedUserStore are given numbers from one counter so they can be merged back into one order.
+//
+// Everything a listing reads is kept in CowVectors, so snapshot() can hand out a copy of the store that shares all of
+// it. The store goes on changing and only copies the chunks the snapshot still has before it changes them
+class UserStore {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = UserView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const UserView*;
+        using reference = const UserView&;
+
+        const_iterator() = default;
+
+        reference operator*() const { return View; }
+        pointer operator->() const { return &View; }
+        const_iterator& operator++();
+        const_iterator operator++(int) { const_iterator old = *this; ++*this; return old; }
+        bool operator==(const const_iterator& other) const { return Slot == other.Slot; }
+        // the number this user was given when it was added
+        uint64_t order() const { return Store->Orders[Slot]; }
+
+    private:
+        friend class UserStore;
+        const_iterator(const UserStore* store, uint32_t slot);
+
+        const UserStore* Store = nullptr;
+        uint32_t Slot = 0;
+        UserView View;
+    };
+
+    UserStore() = default;
+    UserStore(UserStore&&) = default;
+    UserStore& operator=(UserStore&&) = default;
+
+    // the name is the normalized name in UTF-8
+    // returns false and leaves the store unchanged if the user already exists
+    bool insert(std::string_view name, const PhoneNumber& phoneNumber) { return insert(name, phoneNumber, NextOrder); }
+    // order has to be larger than the order of every user added before, so the users stay in order
+    bool insert(std::string_view name, const PhoneNumber& phoneNumber, uint64_t order) { return insert(internName(name), phoneNumber, order); }
+    // For adding a lot of users who share names, like loading a snapshot. A name is interned once and its users are
+    // added by its handle, so the name is not hashed again for every user
+    StringPool::Handle internName(std::string_view name);
+    bool insert(StringPool::Handle name, const PhoneNumber& phoneNumber, uint64_t order);
+    // erasing can rebuild the store, so every iterator is invalid afterwards
+    void erase(const_iterator it);
+    // returns end() if the user is not in the store
+    const_iterator find(std::string_view name, const PhoneNumber& phoneNumber) const;
+    bool contains(std::string_view name, const PhoneNumber& phoneNumber) const { return find(name, phoneNumber) != end(); }
+    void clear();
+    // A copy of the store as it is now for listing it while the store keeps changing, even on another thread. It costs
+    // a pointer for every thousand users and every few hundred names. It can be listed and searched by the start of a
+    // name, but finding users by name or phone number in it finds nothing and it can not be changed
+    UserStore snapshot() const;
+
+    // every user with exactly this name or phone number in the order they were added. Costs roughly the number of matches
+    std::vector<const_iterator> findByName(std::string_view name) const;
+    std::vector<const_iterator> findByPhoneNumber(const PhoneNumber& phoneNumber) const;
+    void reserve(size_t count);
+
+    // Calls visit with a UserView of every user whose name starts with prefix, sorted by name and then in the order
+    // they were added, until visit returns false. An empty prefix visits every user. Costs about log n plus the
+    // number of users visited
+    template<typename Visit>
+    void forEachWithPrefix(std::string_view prefix, Visit&& visit) const {
+        if (!NamesSorted) buildNameIndex();
+        SortedNames.forEachWithPrefix(prefix, Names, [&](StringPool::Handle name) {
+            std::string_view text = Names.get(name);
+            for (uint32_t slot = NameChains[name].first; slot != Nil; slot = UserLinks[slot].nextName) {
+                if (!visit(UserView{text, PhoneNumbers.get(Users[slot].phoneNumber)})) return false;
+            }
+            return true;
+        });
+    }
+    template<typename Visit>
+    void forEachSorted(Visit&& visit) const { forEachWithPrefix({}, visit); }
+    // Builds the sorted names now instead of on the first search. Searching from several threads at once is only
+    // safe once they are built, since the first search would otherwise build them
+    void sortNames() { if (!NamesSorted) buildNameIndex(); }
+    // Moves it past every user added before order and returns how many users it moved past, without looking at
+    // their names or phone numbers
+    size_t skipBefore(const_iterator& it, uint64_t order) const;
+
+    // Walks the names that start with a prefix in order one at a time, so the names of several stores can be merged.
+    // The prefix has to last as long as the cursor
+    class NameCursor {
+    public:
+        bool done() const { return Done; }
+        std::string_view name() const { return Name; }
+        // how many users have this name
+        uint32_t count() const { return Store->NameChains[Handle].count; }
+        // calls visit with every user with this name in the order they were added until visit returns false,
+        // and returns false if it did
+        template<typename Visit>
+        bool forEachUser(Visit&& visit) const {
+            for (uint32_t slot = Store->NameChains[Handle].first; slot != Nil; slot = Store->UserLinks[slot].nextName) {
+                if (!visit(UserView{Name, Store->PhoneNumbers.get(Store->Users[slot].phoneNumber)})) return false;
+            }
+            return true;
+        }
+        void next();
+        // moves past every name before name, which has to start with the prefix, and returns how many users they had
+        size_t skipBefore(std::string_view name);
+        // moves past whole names as long as all their users fit in offset, and returns how many users it moved past
+        size_t skipUsers(size_t offset);
+        // the name this many names on, if there are that many more
+        std::optional<std::string_view> nameAhead(size_t names) const;
+
+    private:
+        friend class UserStore;
+        NameCursor(const UserStore* store, std::string_view prefix);
+        // looks at the name At is on, or finds out there are no more
+        void load();
+
+        const UserStore* Store;
+        std::string_view Prefix;
+        NameIndex::Position At;
+        StringPool::Handle Handle = StringPool::None;
+        std::string_view Name;
+        bool Done = false;
+    };
+    NameCursor names(std::string_view prefix) const {
+        if (!NamesSorted) buildNameIndex();
+        return NameCursor(this, prefix);
+    }
+
+    // Calls visit with count users starting after the first offset, either in the order they were added or sorted
+    // by name. Skipping to the offset does not look at the users it skips, and in sorted order a name with more
+    // users than are left to skip is skipped all at once
+    template<typename Visit>
+    void forEachInPage(size_t offset, size_t count, bool sorted, Visit&& visit) const {
+        if (count == 0) return;
+        if (!sorted) {
+            for (uint32_t slot = 0; slot < Users.size(); slot++) {
+                if (Users[slot].name == StringPool::None) continue;
+                if (offset) {
+                    offset--;
+                    continue;
+                }
+                visit(UserView{Names.get(Users[slot].name), PhoneNumbers.get(Users[slot].phoneNumber)});
+                if (--count == 0) return;
+            }
+            return;
+        }
+
+        NameCursor name = names({});
+        offset -= name.skipUsers(offset);
+        for (; !name.done(); name.next()) {
+            bool more = name.forEachUser([&](const UserView& user) {
+                if (offset) {
+                    offset--;
+                    return true;
+                }
+                visit(user);
+                return --count != 0;
+            });
+            if (!more) return;
+        }
+    }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, Users.size()); }
+    size_t size() const { return Live; }
+    bool empty() const { return Live == 0; }
+
+    // bytes used by the users, the links between them, both pools and the sorted names
+    size_t memoryUsage() const;
+
+private:
+    static constexpr uint32_t Nil = UINT32_MAX;
+
+    // the neighbours of a user in its name list and its phone number list
+    struct Links {
+        uint32_t previousName = Nil, nextName = Nil;
+        uint32_t previousPhone = Nil, nextPhone = Nil;
+    };
+    // the ends of the list for one name or phone number
+    struct Chain {
+        uint32_t first = Nil, last = Nil;
+        uint32_t count = 0;
+    };
+
+    StringPool Names;
+    InternPool<PhoneNumber> PhoneNumbers;
+    // an erased user has a name of StringPool::None
+    CowVector<User> Users;
+    CowVector<Links> UserLinks;
+    CowVector<uint64_t> Orders;
+    uint64_t NextOrder = 0;
+    // indexed by handle. A listing never looks at the users with a phone number, so those are not shared
+    CowVector<Chain> NameChains;
+    std::vector<Chain> PhoneChains;
+    // built by the first search, so changing it is not really changing the users
+    mutable NameIndex SortedNames;
+    mutable bool NamesSorted = false;
+    size_t Live = 0;
+
+    template<uint32_t Links::*Previous, uint32_t Links::*Next>
+    void link(Chain& chain, uint32_t slot);
+    template<uint32_t Links::*Previous, uint32_t Links::*Next>
+    void unlink(Chain& chain, uint32_t slot);
+    uint32_t findSlot(StringPool::Handle name, InternPool<PhoneNumber>::Handle phoneNumber) const;
+    void rebuild();
+    void buildNameIndex() const;
+};
@@ -0,0 +1,304 @@
+#include "utf8.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "uninorms.h"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Converts as many leading ASCII bytes as possible, a whole block at a time
+// Returns how many bytes were converted. The caller decodes the rest one character at a time
+size_t decodeASCII(const unsigned char* in, size_t size, char32_t* out) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= size; i += 32) {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        if (_mm256_movemask_epi8(bytes)) break;
+        for (int j = 0; j < 4; j++) {
+            __m128i eight = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i + j * 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i + j * 8), _mm256_cvtepu8_epi32(eight));
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= size; i += 16) {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        if (_mm_movemask_epi8(bytes)) break;
+        // widen the bytes to 16 bits and then to 32 bits by interleaving with zero
+        __m128i low = _mm_unpacklo_epi8(bytes, zero);
+        __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 12), _mm_unpackhi_epi16(high, zero));
+    }
+#else
+    for (; i + 8 <= size; i += 8) {
+        uint64_t bytes;
+        std::memcpy(&bytes, in + i, 8);
+        if (bytes & 0x8080808080808080) break;
+        for (int j = 0; j < 8; j++) out[i + j] = in[i + j];
+    }
+#endif
+    return i;
+}
+
+// The same as decodeASCII in the other direction. Stops at the first block with a code point above 0x7F
+size_t encodeASCII(const char32_t* in, size_t size, char* out) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i nonASCII = _mm_set1_epi32(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= size; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12));
+        __m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonASCII);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) break;
+        // every value fits in 7 bits so the saturating packs are exact
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+    }
+#endif
+    return i;
+}
+
+bool isContinuation(unsigned char c) { return (c & 0xC0) == 0x80; }
+
+// Decodes one multi byte character. Returns how many bytes it took, or 0 if it is not valid UTF-8
+// (overlong forms, surrogates, values past U+10FFFF or a truncated sequence)
+inline size_t decodeCharacter(const unsigned char* bytes, size_t remaining, char32_t& chr) {
+    unsigned char lead = bytes[0];
+    if (lead >= 0xC2 && lead <= 0xDF) {
+        if (remaining < 2 || !isContinuation(bytes[1])) return 0;
+        chr = (lead & 0x1F) << 6 | (bytes[1] & 0x3F);
+        return 2;
+    }
+    if (lead >= 0xE0 && lead <= 0xEF) {
+        if (remaining < 3 || !isContinuation(bytes[1]) || !isContinuation(bytes[2])) return 0;
+        // reject overlong forms and UTF-16 surrogates
+        if (lead == 0xE0 && bytes[1] < 0xA0) return 0;
+        if (lead == 0xED && bytes[1] > 0x9F) return 0;
+        chr = (lead & 0x0F) << 12 | (bytes[1] & 0x3F) << 6 | (bytes[2] & 0x3F);
+        return 3;
+    }
+    if (lead >= 0xF0 && lead <= 0xF4) {
+        if (remaining < 4 || !isContinuation(bytes[1]) || !isContinuation(bytes[2]) || !isContinuation(bytes[3])) return 0;
+        // reject overlong forms and anything past U+10FFFF
+        if (lead == 0xF0 && bytes[1] < 0x90) return 0;
+        if (lead == 0xF4 && bytes[1] > 0x8F) return 0;
+        chr = (lead & 0x07) << 18 | (bytes[1] & 0x3F) << 12 | (bytes[2] & 0x3F) << 6 | (bytes[3] & 0x3F);
+        return 4;
+    }
+    // a stray continuation byte or a lead byte that can only start an overlong form
+    return 0;
+}
+
+} // namespace
+
+bool decodeUTF8(std::string_view in, std::u32string& out) {
+    // a UTF-8 string never has more code points than bytes
+    out.resize(in.size());
+
+    auto bytes = reinterpret_cast<const unsigned char*>(in.data());
+    size_t size = in.size();
+    char32_t* dst = out.data();
+    size_t i = 0;
+
+    while (i < size) {
+        if (bytes[i] < 0x80) {
+            size_t ascii = decodeASCII(bytes + i, size - i, dst);
+            i += ascii;
+            dst += ascii;
+            // either the block had a multi byte character in it or there were too few bytes left for a block
+            while (i < size && bytes[i] < 0x80) *dst++ = bytes[i++];
+            continue;
+        }
+
+        char32_t chr;
+        size_t length = decodeCharacter(bytes + i, size - i, chr);
+        if (!length) break;
+        i += length;
+
+        *dst++ = chr;
+    }
+
+    if (i < size) {
+        out.clear();
+        return false;
+    }
+
+    out.resize(dst - out.data());
+    return true;
+}
+
+bool decodeUTF8NFC(std::string_view in, std::u32string& out) {
+    using ufal::unilib::uninorms;
+
+    // Normalizing only ever changes one combining sequence at a time, a starter and the marks after it, so the
+    // sequence being read is the only part of the output that is ever looked at again. While it passes the NFC quick
+    // check it is written straight to out from start. Once a character fails the check the sequence is decomposed into
+    // sequence, each mark is sorted into place by its combining class as it comes in, and the whole thing is composed
+    // and written out when the next sequence starts. Normalized text is still only written once
+    out.resize(in.size());
+
+    auto bytes = reinterpret_cast<const unsigned char*>(in.data());
+    size_t size = in.size();
+    size_t i = 0;
+    size_t length = 0;
+
+    size_t start = 0;
+    unsigned lastClass = 0;
+    bool decomposed = false;
+    // Nobody writes a name with more than a handful of marks on one letter, so a sequence that does not fit is
+    // normalized by the old passes instead
+    constexpr int MaxSequence = 32;
+    char32_t sequence[MaxSequence];
+    unsigned classes[MaxSequence];
+    int sequenceLength = 0;
+
+    // adds the decomposition of chr to the sequence, moving each mark in front of the marks with a higher class
+    auto decompose = [&](char32_t chr) {
+        char32_t decomposition[uninorms::MAX_DECOMPOSITION];
+        int count = uninorms::canonical_decomposition(chr, decomposition);
+        if (sequenceLength + count > MaxSequence) return false;
+        for (int k = 0; k < count; k++) {
+            unsigned combiningClass = uninorms::ccc(decomposition[k]);
+            int j = sequenceLength++;
+            if (combiningClass) {
+                for (; j && classes[j - 1] > combiningClass; j--) {
+                    sequence[j] = sequence[j - 1];
+                    classes[j] = classes[j - 1];
+                }
+            }
+            sequence[j] = decomposition[k];
+            classes[j] = combiningClass;
+        }
+        return true;
+    };
+    auto finishSequence = [&] {
+        if (!decomposed) return;
+        size_t composed = uninorms::compose(sequence, sequenceLength);
+        // composing never makes the sequence longer than the bytes it came from, but this does not rely on it
+        if (length + composed + (size - i) > out.size()) out.resize(length + composed + (size - i));
+        std::copy_n(sequence, composed, out.data() + length);
+        length += composed;
+        sequenceLength = 0;
+        decomposed = false;
+    };
+
+    while (i < size) {
+        if (bytes[i] < 0x80) {
+            finishSequence();
+            char32_t* dst = out.data() + length;
+            size_t ascii = decodeASCII(bytes + i, size - i, dst);
+            i += ascii;
+            dst += ascii;
+            while (i < size && bytes[i] < 0x80) *dst++ = bytes[i++];
+            length = dst - out.data();
+            // a mark after the last one could still compose with it
+            start = length - 1;
+            lastClass = 0;
+            continue;
+        }
+
+        char32_t chr;
+        size_t bytesUsed = decodeCharacter(bytes + i, size - i, chr);
+        if (!bytesUsed) break;
+        i += bytesUsed;
+
+        // nothing below the combining diacritics decomposes to anything but a starter and marks that compose back
+        if (chr < 0x300) {
+            finishSequence();
+            start = length;
+            out[length++] = chr;
+            lastClass = 0;
+            continue;
+        }
+
+        unsigned properties = uninorms::nfc_properties(chr);
+        unsigned combiningClass = properties & 0xFF;
+        if (properties & uninorms::NFC_STARTER) {
+            finishSequence();
+            start = length;
+        }
+
+        // the same test as uninorms::is_nfc, one character at a time
+        if (!decomposed && (properties & uninorms::NFC_STABLE) && (!combiningClass || lastClass <= combiningClass)) {
+            out[length++] = chr;
+            lastClass = combiningClass;
+            continue;
+        }
+
+        bool fits = true;
+        if (!decomposed) {
+            // the sequence so far was already normalized, but with chr it has to be decomposed and composed again
+            for (size_t k = start; k < length && fits; k++) fits = decompose(out[k]);
+            length = start;
+            decomposed = true;
+        }
+        if (!fits || !decompose(chr)) {
+            if (!decodeUTF8(in, out)) return false;
+            uninorms::nfc_if_needed(out);
+            return true;
+        }
+    }
+
+    if (i < size) {
+        out.clear();
+        return false;
+    }
+
+    finishSequence();
+    out.resize(length);
+    return true;
+}
+
+void encodeUTF8(std::u32string_view in, std::string& out) {
+    // no code point takes more than 4 bytes
+    out.resize(in.size() * 4);
+
+    const char32_t* src = in.data();
+    size_t size = in.size();
+    char* dst = out.data();
+    size_t i = 0;
+
+    while (i < size) {
+        char32_t chr = src[i];
+
+        if (chr < 0x80) {
+            size_t ascii = encodeASCII(src + i, size - i, dst);
+            i += ascii;
+            dst += ascii;
+            while (i < size && src[i] < 0x80) *dst++ = static_cast<char>(src[i++]);
+            continue;
+        }
+
+        if ((chr >= 0xD800 && chr <= 0xDFFF) || chr > 0x10FFFF) chr = 0xFFFD;
+
+        if (chr < 0x800) {
+            *dst++ = static_cast<char>(0xC0 | chr >> 6);
+            *dst++ = static_cast<char>(0x80 | (chr & 0x3F));
+        } else if (chr < 0x10000) {
+            *dst++ = static_cast<char>(0xE0 | chr >> 12);
+            *dst++ = static_cast<char>(0x80 | (chr >> 6 & 0x3F));
+            *dst++ = static_cast<char>(0x80 | (chr & 0x3F));
+        } else {
+            *dst++ = static_cast<char>(0xF0 | chr >> 18);
+            *dst++ = static_cast<char>(0x80 | (chr >> 12 & 0x3F));
+            *dst++ = static_cast<char>(0x80 | (chr >> 6 & 0x3F));
+            *dst++ = static_cast<char>(0x80 | (chr & 0x3F));
+        }
+        i++;
+    }
+
+    out.resize(dst - out.data());
+}
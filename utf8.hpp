@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// UTF-8 conversion used in place of std::wstring_convert, which is deprecated, allocates a new converter
+// every time it is used and throws on bad input
+// All of them overwrite out but reuse its capacity, so converting into the same string again does not allocate
+
+// Decodes UTF-8 into UTF-32. Returns false if the input is not valid UTF-8
+// (overlong forms, surrogates, values past U+10FFFF or a truncated sequence), in which case out is left empty
+bool decodeUTF8(std::string_view in, std::u32string& out);
+
+// The same, and the result is in Normalization Form C, as if uninorms::nfc_if_needed had been run on it
+// Each combining sequence is normalized as it is read, so the text is gone over once instead of three or four times
+bool decodeUTF8NFC(std::string_view in, std::u32string& out);
+
+// Encodes UTF-32 as UTF-8. Anything that is not a valid code point is written as U+FFFD
+void encodeUTF8(std::u32string_view in, std::string& out);
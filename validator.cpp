@@ -0,0 +1,106 @@
+#include "validator.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "nameScan.hpp"
+#include "utf8.hpp"
+
+bool Validator::normalizeName(std::string_view str, std::u32string& utf32) {
+    // first the name is converted from utf-8 to utf-32 and normalized
+    // utf32 is reused between calls so once it is big enough this does not allocate
+    // If the name is not valid UTF-8 there is nothing to normalize
+    // The normalization will solve some problems of equivialency when performing operations of the set
+    // more can be seen about this here http://unicode.org/reports/tr15/#Norm_Forms
+    // This performs type c normalization, using the tables from https://github.com/ufal/unilib
+    // Both happen in one pass, a combining sequence at a time, instead of decoding and then normalizing the whole name
+    if (!decodeUTF8NFC(str, utf32)) return false;
+
+    // Next I replace all space characters with the normal space character
+    const static std::vector<uint32_t> spaceChars = {9, 160, 5760, 6158, 8192, 8193, 8194, 8195, 8196, 8197, 8198, 8199, 8200, 8201, 8202, 8203, 8239, 8287, 12288, 65279};
+    for (auto& c : utf32) {
+        if (std::binary_search(spaceChars.begin(), spaceChars.end(), c)) {
+            // sets it to the value of the normal space character
+            c = 32;
+        }
+    }
+
+    // Replaces concecutive spaces with a single space
+    std::u32string::iterator new_end = std::unique(utf32.begin(), utf32.end(), [](const char32_t& lhs, const char32_t& rhs) { return (lhs == rhs) && (lhs == 32); });
+    utf32.erase(new_end, utf32.end());
+
+    // If the first character is a space, it is removed
+    if (utf32[0] == 32) utf32.erase(utf32.begin());
+
+    // If the last character is a space, it is removed
+    // Checks if the string is empty first because a single whoule be removed in the previous step
+    if (utf32.size() && utf32[utf32.size() - 1] == 32) utf32.erase(utf32.end() - 1);
+
+    // At this point if a name was all whitespace, it would be now be empty
+
+    return true;
+}
+
+RejectReason Validator::validateName(std::u32string_view name) {
+    size_t position;
+    return validateName(name, position);
+}
+
+RejectReason Validator::validateName(std::u32string_view name, size_t& position) {
+    // after doing much research i have decided to only ban a handful of characters from names
+    // most of the banned chars are Unicode control characters and could never be in a name
+    // The rest are characters that do not display and do effect the appearance of the name ie. the right-to-left mark
+    // I realize this list allows through many problamatic or malicious string but they are not dangerous in the context of this program
+    // This decision was initialy based on not wanting to exclude any real names or
+    // potential real names (hence accepting most UTF-8 supported chars)
+    // This was then backed up by finding out that some places (ie. Kentucky) have potentialy no restrictions on baby names
+    // Kentucky naming law - https://apps.legislature.ky.gov/law/statutes/statute.aspx?id=50029
+    // The banned ranges are listed in nameScan.cpp, where they are checked several characters at a time
+
+    position = std::u32string_view::npos;
+    if(name.empty()) return RejectReason::EmptyName;
+
+    position = findBannedCharacter(name);
+    if (position != std::u32string_view::npos) return RejectReason::ControlCharacter;
+
+    return RejectReason::None;
+}
+
+RejectReason Validator::validatePhoneNumber(std::string_view input, PhoneNumber& phoneNumber) {
+    // The parsing itself lives in phoneNumber.cpp
+    // It used to be a chain of regexes but that was by far the slowest part of loading a file
+    return parsePhoneNumber(input, phoneNumber);
+}
+
+std::span<const ValidationResult> Validator::validate(std::span<const UserRecord> records) {
+    Results.resize(records.size());
+    Names.clear();
+
+    for (size_t i = 0; i < records.size(); i++) {
+        ValidationResult& result = Results[i];
+        result.nameOffset = 0;
+        result.nameLength = 0;
+        result.position = 0;
+
+        if (!normalizeName(records[i].name, Scratch)) {
+            result.reason = RejectReason::InvalidUTF8;
+            continue;
+        }
+
+        size_t position;
+        result.reason = validateName(Scratch, position);
+        if (result.reason != RejectReason::None) {
+            if (position != std::u32string_view::npos) result.position = static_cast<uint32_t>(position);
+            continue;
+        }
+
+        result.reason = parsePhoneNumber(records[i].phoneNumber, result.phoneNumber);
+        if (result.reason != RejectReason::None) continue;
+
+        result.nameOffset = static_cast<uint32_t>(Names.size());
+        result.nameLength = static_cast<uint32_t>(Scratch.size());
+        Names += Scratch;
+    }
+
+    return Results;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "phoneNumber.hpp"
+#include "rejectReason.hpp"
+
+// A name and phone number as they were entered, before any validation
+struct UserRecord {
+    std::string_view name;
+    std::string_view phoneNumber;
+};
+
+// The outcome of validating one UserRecord
+// If reason is RejectReason::None the canonical name can be read with Validator::name
+struct ValidationResult {
+    RejectReason reason;
+    PhoneNumber phoneNumber;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    // for RejectReason::ControlCharacter, which character of the normalized name is not allowed, counting from 0
+    uint32_t position;
+};
+
+// Name and phone number validation, usable on its own without a Database
+// Nothing here does any I/O, so it can be called in process by anything that needs to validate users
+class Validator {
+public:
+    // Validates a whole batch. The results line up with the records and stay valid until the next call to validate
+    // The buffers are reused between calls so validating batches of a similar size does not allocate
+    std::span<const ValidationResult> validate(std::span<const UserRecord> records);
+    std::u32string_view name(const ValidationResult& result) const { return std::u32string_view(Names).substr(result.nameOffset, result.nameLength); }
+
+    // Converts a name to normalized UTF-32 in utf32. Returns false if it is not valid UTF-8
+    static bool normalizeName(std::string_view str, std::u32string& utf32);
+    // Checks a name that has already been normalized
+    static RejectReason validateName(std::u32string_view name);
+    // The same, and if a character is not allowed position is set to where it is in the name, otherwise to npos
+    static RejectReason validateName(std::u32string_view name, size_t& position);
+    // Validates a phone number and packs it into phoneNumber if it is valid
+    static RejectReason validatePhoneNumber(std::string_view input, PhoneNumber& phoneNumber);
+
+private:
+    std::vector<ValidationResult> Results;
+    // every valid name in the batch back to back
+    std::u32string Names;
+    std::u32string Scratch;
+};